@@ -0,0 +1,97 @@
+#!/bin/sh
+name=`basename $0`
+usage () {
+cat <<EOF
+usage: $name [ -h ] [ -b <build> ... ] [ <dimacs> ... ]
+
+  -h          prints this command line option usage summary
+  -b <build>  build directory with 'cadical' to compare (default '../build',
+              can be given multiple times)
+  <dimacs>    CNF files to benchmark (default '../test/cnf/*.cnf' and
+              generated uniform random 3-SAT formulas)
+
+Compares search propagations per second of different builds, e.g., one
+with the current and one with a changed clause layout (see the comment
+before 'struct Clause' in '../src/clause.hpp').  As long as the changes do
+not affect the search, all builds perform the same propagations and only
+the time differs.  Runs are limited to '$conflicts' conflicts (set
+'CONFLICTS' to change) and the fastest of '$runs' runs (set 'RUNS') is
+reported.
+EOF
+exit 0
+}
+die () {
+  echo "$name: error: $*" 1>&2
+  exit 1
+}
+conflicts=${CONFLICTS-50000}
+runs=${RUNS-3}
+builds=""
+while [ $# -gt 0 ]
+do
+  case $1 in
+    -h) usage;;
+    -b) [ $# -gt 1 ] || die "argument to '-b' missing"
+        shift
+        test -f $1/cadical || die "could not find '$1/cadical'"
+        builds="$builds $1";;
+    -*) die "invalid option '$1' (try '-h')";;
+    *) break;;
+  esac
+  shift
+done
+[ x"$builds" = x ] && builds=`dirname $0`/../build
+for build in $builds
+do
+  test -f $build/cadical || die "could not find '$build/cadical'"
+done
+tmp=/tmp/$name-$$
+trap "rm -rf $tmp" 0 1 2 3 15
+mkdir $tmp || exit 1
+if [ $# = 0 ]
+then
+  set -- `dirname $0`/../test/cnf/*.cnf
+  for vars in 20000 100000 400000
+  do
+    cnf=$tmp/random-3-sat-$vars.cnf
+    awk -v n=$vars 'BEGIN {
+      srand (n); m = int (4.2 * n); print "p cnf", n, m
+      for (i = 0; i < m; i++) {
+        for (j = 0; j < 3; j++) {
+          v = 1 + int (n * rand ()); if (rand () < 0.5) v = -v
+          printf "%d ", v
+        }
+        print 0
+      }
+    }' > $cnf
+    set -- "$@" $cnf
+  done
+fi
+printf "%-28s %-16s %12s %9s %12s\n" \
+  "benchmark" "build" "searchprops" "seconds" "per second"
+for cnf in "$@"
+do
+  base=`basename $cnf .cnf`
+  for build in $builds
+  do
+    i=0
+    while [ $i -lt $runs ]
+    do
+      $build/cadical -n --stats -c $conflicts $cnf > $tmp/log-$i 2>&1
+      i=`expr $i + 1`
+    done
+    cat $tmp/log-* | \
+    awk -v base=$base -v build=`basename $build` '
+/^c   searchprops:/ { props = $3 }
+/^c total process time/ {
+  if (!runs || $(NF-1) < seconds) seconds = $(NF-1)
+  runs++
+}
+END {
+  rate = seconds > 0 ? props / seconds : 0
+  printf "%-28s %-16s %12d %9.2f %12.0f\n",
+    base, build, props, seconds, rate
+}'
+    rm -f $tmp/log-*
+  done
+done
@@ -0,0 +1,69 @@
+#!/bin/sh
+name=`basename $0`
+usage () {
+cat <<EOF
+usage: $name [ -h ] [ <dimacs> ... ]
+
+  -h        prints this command line option usage summary
+  <dimacs>  CNF files to benchmark (default '../test/cnf/*.cnf' and
+            generated uniform random 3-SAT formulas)
+
+Compares decisions plus score bumps per second for all score heap arities
+('--scorearity=1' is the binary heap) in stable mode, where the EVSIDS
+heap is used.  The search does not depend on the arity, thus the same
+decisions and bumps are performed and only the time differs.  Runs are
+limited to '$conflicts' conflicts (set 'CONFLICTS' to change).
+EOF
+exit 0
+}
+die () {
+  echo "$name: error: $*" 1>&2
+  exit 1
+}
+conflicts=${CONFLICTS-50000}
+[ x"$1" = x-h ] && usage
+cadical=`dirname $0`/../build/cadical
+[ x"$CADICALBUILD" = x ] || cadical=$CADICALBUILD/cadical
+test -f $cadical || die "could not find '$cadical'"
+tmp=/tmp/$name-$$
+trap "rm -rf $tmp" 0 1 2 3 15
+mkdir $tmp || exit 1
+if [ $# = 0 ]
+then
+  set -- `dirname $0`/../test/cnf/*.cnf
+  for vars in 20000 100000 400000
+  do
+    cnf=$tmp/random-3-sat-$vars.cnf
+    awk -v n=$vars 'BEGIN {
+      srand (n); m = int (4.2 * n); print "p cnf", n, m
+      for (i = 0; i < m; i++) {
+        for (j = 0; j < 3; j++) {
+          v = 1 + int (n * rand ()); if (rand () < 0.5) v = -v
+          printf "%d ", v
+        }
+        print 0
+      }
+    }' > $cnf
+    set -- "$@" $cnf
+  done
+fi
+printf "%-28s %6s %12s %12s %9s %12s\n" \
+  "benchmark" "arity" "decisions" "scorebumps" "seconds" "per second"
+for cnf in "$@"
+do
+  base=`basename $cnf .cnf`
+  for arity in 1 2 3 4
+  do
+    $cadical -n --stats --stabilizeonly=1 --scorearity=$arity \
+      -c $conflicts $cnf > $tmp/log 2>&1
+    awk -v base=$base -v arity=$arity '
+/^c decisions:/ { decisions = $3 }
+/^c   scorebumped:/ { bumps = $3 }
+/^c total process time/ { seconds = $(NF-1) }
+END {
+  rate = seconds > 0 ? (decisions + bumps) / seconds : 0
+  printf "%-28s %6d %12d %12d %9.2f %12.0f\n",
+    base, 2^arity, decisions, bumps, seconds, rate
+}' $tmp/log
+  done
+done
@@ -64,6 +64,40 @@ void Internal::bump_queue (int lit) {
     update_queue_unassigned (idx);
 }
 
+// Batched version of 'bump_queue' for all the (already sorted) analyzed
+// variables.  They are first all dequeued and then linked as one block to
+// the end of the queue, which only touches the links of their neighbours
+// once.  As for a sequence of 'bump_queue' calls the block keeps the
+// sorted order and the last unassigned bumped variable becomes the new
+// 'queue.unassigned', thus the resulting queue order is the same.
+
+void Internal::bump_queue_batch () {
+  assert (opts.bump);
+  assert (analyzed.size () > 1);
+  for (const auto &lit : analyzed)
+    queue.dequeue (links, vidx (lit));
+  int prev = queue.last, unassigned = 0;
+  for (const auto &lit : analyzed) {
+    const int idx = vidx (lit);
+    Link &l = links[idx];
+    if ((l.prev = prev))
+      links[prev].next = idx;
+    else
+      queue.first = idx;
+    assert (stats.bumped != INT64_MAX);
+    btab[idx] = ++stats.bumped;
+    if (!vals[idx])
+      unassigned = idx;
+    prev = idx;
+  }
+  links[prev].next = 0;
+  queue.last = prev;
+  LOG ("moved to front %zd variables and bumped to %" PRId64 "",
+       analyzed.size (), stats.bumped);
+  if (unassigned)
+    update_queue_unassigned (unassigned);
+}
+
 /*------------------------------------------------------------------------*/
 
 // It would be better to use 'isinf' but there are some historical issues
@@ -102,7 +136,7 @@ void Internal::rescale_variable_scores () {
          stats.conflicts);
 }
 
-void Internal::bump_variable_score (int lit) {
+void Internal::bump_variable_score (int lit, bool update) {
   assert (opts.bump);
   int idx = vidx (lit);
   double old_score = score (idx);
@@ -118,10 +152,32 @@ void Internal::bump_variable_score (int lit) {
   assert (!evsids_limit_hit (new_score));
   LOG ("new %g score of %d", new_score, idx);
   score (idx) = new_score;
-  if (scores.contains (idx))
+  stats.scorebumped++;
+  if (update && scores.contains (idx))
     scores.update (idx);
 }
 
+// If a large fraction of the variables on the heap is bumped at once (as
+// for learned clauses with thousands of analyzed literals) we only update
+// the scores and then rebuild the heap once in linear time instead of
+// moving each bumped variable up separately.  Since scores are totally
+// ordered the decisions do not change.
+
+void Internal::bump_variable_scores_batch () {
+  assert (opts.bump);
+  const size_t bumped = analyzed.size ();
+  if (100.0 * bumped < opts.bumpbatchheap * (double) scores.size ()) {
+    for (const auto &lit : analyzed)
+      bump_variable_score (lit);
+    return;
+  }
+  for (const auto &lit : analyzed)
+    bump_variable_score (lit, false);
+  LOG ("rebuilding score heap after bumping %zd variables", bumped);
+  scores.rebuild ();
+  stats.heapified++;
+}
+
 // Important variables recently used in conflict analysis are 'bumped',
 
 void Internal::bump_variable (int lit) {
@@ -190,8 +246,16 @@ void Internal::bump_variables () {
            analyze_bumped_rank (this), analyze_bumped_smaller (this));
   }
 
-  for (const auto &lit : analyzed)
-    bump_variable (lit);
+  if (opts.cprofile)
+    cprofile.current.bump += analyzed.size ();
+
+  if (!opts.bumpbatch || analyzed.size () < 2) {
+    for (const auto &lit : analyzed)
+      bump_variable (lit);
+  } else if (use_scores ())
+    bump_variable_scores_batch ();
+  else
+    bump_queue_batch ();
 
   if (use_scores ())
     bump_variable_score_inc ();
@@ -319,8 +383,20 @@ inline void Internal::analyze_reason (int lit, Clause *reason, int &open,
   assert (reason);
   assert (reason != external_reason);
   bump_clause (reason);
+  if (opts.cprofile)
+    cprofile_reason (reason);
   if (lrat)
     lrat_chain.push_back (reason->id);
+  // The variable and flag tables are separate arrays and thus analyzing a
+  // literal of a large instance usually costs two cache misses.  By
+  // touching all of them first these misses of the (independent) literals
+  // in the reason are overlapped.  For small instances the tables stay in
+  // the cache anyhow and prefetching only costs time.
+  if (max_var >= opts.prefetchvars)
+    for (const auto &other : *reason) {
+      __builtin_prefetch (&var (other), 0, 1);
+      __builtin_prefetch (&flags (other), 1, 1);
+    }
   for (const auto &other : *reason)
     if (other != lit)
       analyze_literal (other, open, resolvent_size, antecedent_size);
@@ -368,6 +444,8 @@ inline void Internal::bump_also_reason_literals (int lit, int depth_limit,
   if (!reason || reason == external_reason)
     return;
   stats.ticks.search[stable]++;
+  if (opts.cprofile)
+    cprofile.current.bump++;
   for (const auto &other : *reason) {
     if (other == lit)
       continue;
@@ -947,6 +1025,9 @@ void Internal::analyze () {
   assert (unit_analyzed.empty ());
   assert (clause.empty ());
 
+  if (opts.cprofile)
+    cprofile_start ();
+
   // First update moving averages of trail height at conflict.
   //
   UPDATE_AVERAGE (averages.current.trail.fast, num_assigned);
@@ -1190,7 +1271,7 @@ void Internal::analyze () {
   // Update glue and learned (1st UIP literals) statistics.
   //
   int size = (int) clause.size ();
-  const int glue = (int) levels.size () - 1;
+  int glue = (int) levels.size () - 1;
   LOG (clause, "1st UIP size %d and glue %d clause", size, glue);
   UPDATE_AVERAGE (averages.current.glue.fast, glue);
   UPDATE_AVERAGE (averages.current.glue.slow, glue);
@@ -1213,6 +1294,8 @@ void Internal::analyze () {
       shrink_and_minimize_clause ();
     else if (opts.minimize)
       minimize_clause ();
+    if (opts.minimizebin)
+      minimize_clause_with_binaries (-uip, glue);
 
     size = (int) clause.size ();
 
@@ -1223,7 +1306,7 @@ void Internal::analyze () {
       bump_variables ();
     }
 
-    if (external->learner)
+    if (external->learner && (!opts.exportglue || glue <= opts.exportglue))
       external->export_learned_large_clause (clause);
   } else if (external->learner)
     external->export_learned_unit_clause (-uip);
@@ -1234,6 +1317,9 @@ void Internal::analyze () {
   stats.binaries += (size == 2);
   UPDATE_AVERAGE (averages.current.size, size);
 
+  if (opts.cprofile)
+    cprofile_record ();
+
   // reverse lrat_chain. We could probably work with reversed iterators
   // (views) to be more efficient but we would have to distinguish in proof
   //
@@ -1254,6 +1340,8 @@ void Internal::analyze () {
 
   int new_level = determine_actual_backtrack_level (jump);
   UPDATE_AVERAGE (averages.current.level, new_level);
+  if (opts.trailsave && new_level < level)
+    save_trail (new_level);
   backtrack (new_level);
 
   // It should hold that (!level <=> size == 1)
@@ -1,5 +1,11 @@
 #include "internal.hpp"
 
+#ifdef __linux__
+extern "C" {
+#include <sys/mman.h>
+}
+#endif
+
 namespace CaDiCaL {
 
 Arena::Arena (Internal *i) {
@@ -8,23 +14,62 @@ Arena::Arena (Internal *i) {
 }
 
 Arena::~Arena () {
-  delete[] from.start;
-  delete[] to.start;
+  release (from.start, from.mapped);
+  release (to.start, to.mapped);
+}
+
+// Allocate memory for a space of the arena.  If huge pages are requested
+// and supported we map the memory (rounded up to a multiple of the huge
+// page size) and set 'mapped' to the size of the mapping.  Otherwise, or
+// if mapping fails, we fall back to the standard allocator.
+
+char *Arena::allocate (size_t bytes, size_t &mapped) {
+  mapped = 0;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (internal->opts.arenahuge && bytes) {
+    const size_t huge_page_size = 1u << 21;
+    const size_t size = align (bytes, huge_page_size);
+    void *p = mmap (0, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p != MAP_FAILED) {
+      if (madvise (p, size, MADV_HUGEPAGE))
+        LOG ("could not advise huge pages for %zd bytes", size);
+      mapped = size;
+      LOG ("mapped %zd bytes for arena", size);
+      return (char *) p;
+    }
+    LOG ("mapping %zd bytes for arena failed", size);
+  }
+#endif
+  return new char[bytes];
+}
+
+void Arena::release (char *start, size_t mapped) {
+#ifdef __linux__
+  if (mapped) {
+    munmap (start, mapped);
+    return;
+  }
+#else
+  assert (!mapped);
+#endif
+  delete[] start;
 }
 
 void Arena::prepare (size_t bytes) {
   LOG ("preparing 'to' space of arena with %zd bytes", bytes);
   assert (!to.start);
-  to.top = to.start = new char[bytes];
+  to.top = to.start = allocate (bytes, to.mapped);
   to.end = to.start + bytes;
 }
 
 void Arena::swap () {
-  delete[] from.start;
+  release (from.start, from.mapped);
   LOG ("delete 'from' space of arena with %zd bytes",
        (size_t) (from.end - from.start));
   from = to;
   to.start = to.top = to.end = 0;
+  to.mapped = 0;
 }
 
 } // namespace CaDiCaL
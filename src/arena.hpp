@@ -50,6 +50,13 @@ namespace CaDiCaL {
 //   ...
 //
 // One has to be really careful with 'qi' references to arena memory.
+//
+// On Linux the 'to' space can optionally ('opts.arenahuge') be allocated
+// with 'mmap' and then be advised to be backed by transparent huge pages.
+// For large arenas this reduces TLB misses while accessing clauses during
+// propagation.  The operating system decides whether huge pages are really
+// used and 'print_resource_usage' reports how much memory is backed by
+// huge pages in the end.
 
 struct Internal;
 
@@ -59,8 +66,12 @@ class Arena {
 
   struct {
     char *start, *top, *end;
+    size_t mapped; // Non-zero if memory mapped (see 'opts.arenahuge').
   } from, to;
 
+  char *allocate (size_t bytes, size_t &mapped);
+  void release (char *start, size_t mapped);
+
 public:
   Arena (Internal *);
   ~Arena ();
@@ -86,10 +97,18 @@ public:
   // not matter whether 'p' is in 'from' or allocated outside of the arena.
   //
   char *copy (const char *p, size_t bytes) {
+    char *res = reserve (bytes);
+    memcpy (res, p, bytes);
+    return res;
+  }
+
+  // Same as 'copy' but without copying, which is left to the caller, e.g.,
+  // the parallel copying in 'copy_moving_clauses'.
+  //
+  char *reserve (size_t bytes) {
     char *res = to.top;
     to.top += bytes;
     assert (to.top <= to.end);
-    memcpy (res, p, bytes);
     return res;
   }
 
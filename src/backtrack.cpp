@@ -174,4 +174,39 @@ void Internal::backtrack_without_updating_phases (int new_level) {
   assert (num_assigned == trail.size ());
 }
 
+/*------------------------------------------------------------------------*/
+
+// Trail saving as in the SAT'20 paper by Randy Hickey and Fahiem Bacchus.
+// Before back-jumping after a conflict the literals which are about to be
+// unassigned are saved together with their reasons (in trail order and
+// with 'decisions' having a zero reason).  Their positions are stored in
+// 'saved_positions' too.  If later any saved literal is propagated again,
+// then the following implied literals are reassigned directly with their
+// saved reasons in 'replay_saved_trail' without searching the watch lists
+// for them.  Their watches still need to be visited, but the clauses which
+// were the reason for them are then already satisfied.  This also finds
+// conflicts early if a saved literal is false now.  Out-of-order literals
+// kept on the trail with chronological backtracking are not saved.
+
+void Internal::save_trail (int new_level) {
+  assert (opts.trailsave);
+  assert (new_level < level);
+  clear_saved_trail ();
+  const size_t assigned = control[new_level + 1].trail;
+  for (size_t i = assigned; i < trail.size (); i++) {
+    const int lit = trail[i];
+    const Var &v = var (lit);
+    if (v.level <= new_level)
+      continue;
+    if (v.reason == external_reason)
+      break;
+    saved_trail.push_back (lit);
+    saved_reasons.push_back (v.reason);
+    saved_positions[vidx (lit)] = saved_trail.size ();
+  }
+  LOG ("saved %zd trail literals above level %d", saved_trail.size (),
+       new_level);
+  stats.trailsave.saved += saved_trail.size ();
+}
+
 } // namespace CaDiCaL
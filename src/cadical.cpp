@@ -5,6 +5,13 @@
 #include "internal.hpp"
 #include "signal.hpp" // Separate, only need for apps.
 
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
 /*------------------------------------------------------------------------*/
 
 namespace CaDiCaL {
@@ -50,6 +57,17 @@ class App : public Handler, public Terminator {
   int max_var;           // Set after parsing.
   volatile bool timesup; // Asynchronous termination.
 
+  // Portfolio solving with '--threads=<n>'.
+  //
+  int threads;
+  int epoch_ticks; // Reproducible with '--deterministic' if positive.
+  int solve_portfolio (int conflict_limit, int decision_limit);
+
+  // Cube-and-conquer with '--cubes=<depth>'.
+  //
+  int cube_depth;
+  int solve_cubes (int conflict_limit, int decision_limit);
+
   // Printing.
   //
   void print_usage (bool all = false);
@@ -149,8 +167,18 @@ void App::print_usage (bool all) {
 "  -c <limit>     limit the number of conflicts (default unlimited)\n"
 "  -d <limit>     limit the number of decisions (default unlimited)\n"
 "\n"
+"  --threads=<n>  run a portfolio of '<n>' diversified solver threads\n"
+"  --deterministic[=<ticks>]\n"
+"                 synchronize portfolio threads every '<ticks>' search\n"
+"                 ticks (default 1e6) for reproducible results (requires\n"
+"                 '--threads=<n>' with '<n>' larger than one)\n"
+"  --cubes=<d>    split into cubes of depth '<d>' solved by the threads\n"
+"                 (limits '-c' and '-d' are global for all cubes)\n"
+"\n"
 "  -o <output>    write simplified CNF in DIMACS format to file\n"
 "  -e <extend>    write reconstruction/extension stack to file\n"
+"  --conflict-profile=<json>\n"
+"                 write conflict analysis profile in JSON to file\n"
 #ifdef LOGGING
 "  -l             enable logging messages (same as '--log')\n"
 #endif
@@ -383,10 +411,14 @@ int App::main (int argc, char **argv) {
   bool proof_specified = false, dimacs_specified = false;
   int optimize = 0, preprocessing = 0, localsearch = 0;
   const char *output_path = 0, *extension_path = 0;
+  const char *conflict_profile_path = 0;
   int conflict_limit = -1, decision_limit = -1;
   const char *conflict_limit_specified = 0;
   const char *decision_limit_specified = 0;
   const char *localsearch_specified = 0;
+  const char *threads_specified = 0;
+  const char *deterministic_specified = 0;
+  const char *cubes_specified = 0;
 #ifndef __MINGW32__
   const char *time_limit_specified = 0;
 #endif
@@ -447,6 +479,19 @@ int App::main (int argc, char **argv) {
         APPERR ("extension file '%s' not writable", argv[i]);
       else
         extension_path = argv[i];
+    } else if (has_prefix (argv[i], "--conflict-profile=")) {
+      if (conflict_profile_path)
+        APPERR ("multiple conflict profile options '--conflict-profile=%s' "
+                "and '%s'",
+                conflict_profile_path, argv[i]);
+      else if (!argv[i][19])
+        APPERR ("argument to '--conflict-profile=' missing");
+      else if (!File::writable (argv[i] + 19))
+        APPERR ("conflict profile file '%s' not writable", argv[i] + 19);
+      else {
+        conflict_profile_path = argv[i] + 19;
+        set ("cprofile", 1);
+      }
     } else if (is_color_option (argv[i])) {
       tout.force_colors ();
       terr.force_colors ();
@@ -516,6 +561,39 @@ int App::main (int argc, char **argv) {
         time_limit_specified = argv[i];
     }
 #endif
+    else if (has_prefix (argv[i], "--threads=")) {
+      if (threads_specified)
+        APPERR ("multiple thread options '%s' and '%s'", threads_specified,
+                argv[i]);
+      threads_specified = argv[i];
+      if (!parse_int_str (argv[i] + 10, threads))
+        APPERR ("invalid thread option '%s'", argv[i]);
+      if (threads < 1)
+        APPERR ("invalid argument in '%s' (expected positive number)",
+                argv[i]);
+    } else if (!strcmp (argv[i], "--deterministic") ||
+               has_prefix (argv[i], "--deterministic=")) {
+      if (deterministic_specified)
+        APPERR ("multiple deterministic options '%s' and '%s'",
+                deterministic_specified, argv[i]);
+      deterministic_specified = argv[i];
+      if (!argv[i][15])
+        epoch_ticks = 1e6;
+      else if (!parse_int_str (argv[i] + 16, epoch_ticks))
+        APPERR ("invalid deterministic option '%s'", argv[i]);
+      else if (epoch_ticks < 1)
+        APPERR ("invalid argument in '%s' (expected positive number)",
+                argv[i]);
+    } else if (has_prefix (argv[i], "--cubes=")) {
+      if (cubes_specified)
+        APPERR ("multiple cube options '%s' and '%s'", cubes_specified,
+                argv[i]);
+      cubes_specified = argv[i];
+      if (!parse_int_str (argv[i] + 8, cube_depth))
+        APPERR ("invalid cube option '%s'", argv[i]);
+      if (cube_depth < 1 || cube_depth > 20)
+        APPERR ("invalid argument in '%s' (expected '1..20')", argv[i]);
+    }
 #ifndef QUIET
     else if (!strcmp (argv[i], "-q"))
       set ("--quiet");
@@ -594,6 +672,17 @@ int App::main (int argc, char **argv) {
       !strcmp (dimacs_path, proof_path) && strcmp (dimacs_path, "-"))
     APPERR ("DIMACS input file '%s' also specified as DRAT proof file",
             dimacs_path);
+  if (threads > 1 && proof_specified)
+    APPERR ("can not write proofs with multiple threads '%s'",
+            threads_specified);
+  if (cubes_specified && proof_specified)
+    APPERR ("can not write proofs with cubes '%s'", cubes_specified);
+  if (cubes_specified && deterministic_specified)
+    APPERR ("can not combine '%s' and '%s'", cubes_specified,
+            deterministic_specified);
+  if (deterministic_specified && threads < 2)
+    APPERR ("'%s' requires multiple threads (use '--threads=<n>')",
+            deterministic_specified);
 
   /*----------------------------------------------------------------------*/
   // The '--less' option is not fully functional yet (it is also not
@@ -720,6 +809,8 @@ int App::main (int argc, char **argv) {
                                cube_literals);
   if (err)
     APPERR ("%s", err);
+  if (incremental && cubes_specified)
+    APPERR ("can not use '%s' with incremental input", cubes_specified);
   if (read_solution_path) {
     solver->section ("parsing solution");
     solver->message ("reading solution file from '%s'", read_solution_path);
@@ -859,6 +950,12 @@ int App::main (int argc, char **argv) {
 
     if (inconclusive && res == 20)
       res = 0;
+  } else if (cube_depth) {
+    solver->section ("cube-and-conquer");
+    res = solve_cubes (conflict_limit, decision_limit);
+  } else if (threads > 1) {
+    solver->section ("portfolio solving");
+    res = solve_portfolio (conflict_limit, decision_limit);
   } else {
     solver->section ("solving");
     res = solver->solve ();
@@ -888,6 +985,16 @@ int App::main (int argc, char **argv) {
       APPERR ("%s", err);
   }
 
+  if (conflict_profile_path) {
+    solver->section ("writing conflict profile");
+    solver->message ("writing conflict profile to %s'%s'%s",
+                     tout.green_code (), conflict_profile_path,
+                     tout.normal_code ());
+    err = solver->write_conflict_profile (conflict_profile_path);
+    if (err)
+      APPERR ("%s", err);
+  }
+
   solver->section ("result");
 
   FILE *write_result_file;
@@ -935,6 +1042,573 @@ int App::main (int argc, char **argv) {
 
 /*------------------------------------------------------------------------*/
 
+// Simple portfolio solver.  The parsed formula is copied 'threads - 1'
+// times, which avoids parsing it again.  The copies are diversified by
+// using the 'sat', 'unsat' and 'plain' configurations first and then
+// shuffling the variable order with different seeds.  All solvers run in
+// parallel, each in its own thread, and the first one finishing with a
+// result stops all others through the 'Terminator' interface.  That
+// winner then replaces the original solver for printing the witness and
+// statistics, which makes the rest of 'App::main' oblivious to whether a
+// portfolio has been used.
+
+struct Portfolio : public Terminator {
+  volatile bool &timesup;
+  std::atomic<int> winner;
+  Portfolio (volatile bool &t) : timesup (t), winner (-1) {}
+  bool terminate () { return timesup || winner.load () >= 0; }
+};
+
+// Units, binary clauses and learned clauses with small glue (see
+// 'opts.exportglue') are shared between the solvers of the portfolio
+// through a common buffer.  Each clause is stored with the index of the
+// exporting solver followed by its literals and a zero.  Duplicates are
+// filtered by hashing the sorted clauses.  Each solver keeps its own
+// position in the buffer and imports the clauses of the others during
+// restarts.  The buffer size is also kept atomically, such that checking
+// for new clauses does not need to take the lock.
+//
+// Positions are absolute, while the buffer only keeps the clauses starting
+// at 'offset'.  If the buffer reaches its 'capacity' the prefix which all
+// solvers have already imported is recycled, together with the hashes of
+// its clauses, but only if this frees at least half of the buffer.  As
+// long as this is not possible (a solver did not import for a long time)
+// clauses are dropped instead of shared.
+
+struct Sharing {
+  static const size_t capacity = 1u << 26; // Literals in buffer.
+  std::mutex lock;
+  vector<int> buffer;
+  std::atomic<size_t> size;
+  size_t offset;
+  vector<size_t> positions; // Import positions of the solvers.
+  std::unordered_set<uint64_t> hashes;
+  size_t clauses, recycled, dropped;
+  Internal *internal; // Of the original solver for verbose messages.
+  bool full;
+  Sharing (int threads, Internal *i)
+      : size (0), offset (0), positions (threads, 0), clauses (0),
+        recycled (0), dropped (0), internal (i), full (false) {}
+  static uint64_t hash (const int *begin, const int *end) {
+    uint64_t res = end - begin;
+    for (const int *p = begin; p != end; p++)
+      res = 1000000007ull * res + (unsigned) *p;
+    return res;
+  }
+  bool recycle () {
+    size_t position = size.load ();
+    for (const auto &other : positions)
+      position = min (position, other);
+    const size_t freed = position - offset;
+    if (freed < buffer.size () / 2)
+      return false;
+    const int *p = buffer.data (), *end = p + freed;
+    while (p != end) {
+      const int *begin = ++p;
+      while (*p)
+        p++;
+      hashes.erase (hash (begin, p++));
+      recycled++;
+    }
+    buffer.erase (buffer.begin (), buffer.begin () + freed);
+    offset = position;
+    return true;
+  }
+  void share (int source, vector<int> &clause) {
+    sort (clause.begin (), clause.end ());
+    const int *literals = clause.data ();
+    const uint64_t h = hash (literals, literals + clause.size ());
+    std::lock_guard<std::mutex> guard (lock);
+    if (buffer.size () + clause.size () + 2 > capacity && !recycle ()) {
+      if (!full)
+        internal->verbose (1,
+                           "sharing buffer full after %zu clauses "
+                           "(dropping clauses until recycled)",
+                           clauses);
+      full = true; // Only report once.
+      dropped++;
+      return;
+    }
+    if (!hashes.insert (h).second)
+      return;
+    buffer.push_back (source);
+    for (const auto &lit : clause)
+      buffer.push_back (lit);
+    buffer.push_back (0);
+    size.store (offset + buffer.size ());
+    clauses++;
+  }
+
+  // Solvers which stopped do not import anymore and should not prevent
+  // recycling the buffer.
+  //
+  void retire (int source) {
+    std::lock_guard<std::mutex> guard (lock);
+    positions[source] = std::numeric_limits<size_t>::max ();
+  }
+};
+
+class Share : public Learner, public Importer {
+  Sharing &sharing;
+  const int source, max_var;
+  vector<int> learned, imported, pending;
+  size_t &position; // In 'sharing.positions'.
+  size_t next;
+  bool skip, deferred, loaded;
+
+public:
+  Share (Sharing &s, int i, int m, bool d)
+      : sharing (s), source (i), max_var (m), position (s.positions[i]),
+        next (0), skip (false), deferred (d), loaded (false) {}
+
+  // Clauses with extension variables (introduced by 'factor') can not be
+  // shared, since those are solver specific.
+  //
+  bool learning (int) {
+    skip = false;
+    return true;
+  }
+  void learn (int lit) {
+    if (!lit) {
+      if (skip)
+        ;
+      else if (deferred) {
+        pending.insert (pending.end (), learned.begin (), learned.end ());
+        pending.push_back (0);
+      } else
+        sharing.share (source, learned);
+      learned.clear ();
+    } else if (abs (lit) > max_var)
+      skip = true;
+    else if (!skip)
+      learned.push_back (lit);
+  }
+
+  // Keeps announcing the loaded clause until it is completely imported.
+  //
+  bool importing () {
+    if (loaded)
+      return true;
+    if (position == sharing.size.load ())
+      return false;
+    std::lock_guard<std::mutex> guard (sharing.lock);
+    const vector<int> &buffer = sharing.buffer;
+    const size_t offset = sharing.offset;
+    while (position < offset + buffer.size ()) {
+      const int other = buffer[position++ - offset];
+      size_t end = position;
+      while (buffer[end - offset])
+        end++;
+      if (other == source) {
+        position = end + 1;
+        continue;
+      }
+      imported.assign (buffer.begin () + (position - offset),
+                       buffer.begin () + (end - offset));
+      imported.push_back (0);
+      position = end + 1;
+      next = 0;
+      loaded = true;
+      return true;
+    }
+    return false;
+  }
+  int import () {
+    const int lit = imported[next++];
+    if (!lit)
+      loaded = false;
+    return lit;
+  }
+
+  // In deterministic mode learned clauses are kept in 'pending' and only
+  // shared at the end of an epoch through this function.
+  //
+  void publish () {
+    auto begin = pending.begin ();
+    for (auto end = begin; end != pending.end (); end++) {
+      if (*end)
+        continue;
+      learned.assign (begin, end);
+      sharing.share (source, learned);
+      begin = end + 1;
+    }
+    learned.clear ();
+    pending.clear ();
+  }
+};
+
+// With '--deterministic' the portfolio gives the same result and the same
+// statistics for the same options and number of threads.  Time is split
+// into epochs measured in search ticks, which every solver checks when its
+// terminator is polled (at deterministic points of its search).  At the
+// end of an epoch it waits until all other running solvers reached the
+// end of the same epoch.  Only then the clauses learned during the epoch
+// are shared, in the order of the solvers, and only then the winner is
+// determined, as the solver with the smallest index among those which
+// finished with a result during the epoch.
+
+struct Epochs {
+  Portfolio &portfolio;
+  vector<Share *> &shares;
+  const vector<int> &results;
+  const int64_t length;
+  std::mutex lock;
+  std::condition_variable synchronized;
+  int64_t epoch;
+  int running, waiting;
+  vector<int> finished;
+
+  Epochs (Portfolio &p, vector<Share *> &s, const vector<int> &r, int l)
+      : portfolio (p), shares (s), results (r), length (l), epoch (0),
+        running (s.size ()), waiting (0) {}
+
+  // Called with the lock held by the last solver reaching the epoch end.
+  //
+  void complete () {
+    for (auto &share : shares)
+      share->publish ();
+    int winner = -1;
+    for (const auto &i : finished)
+      if (results[i] && (winner < 0 || i < winner))
+        winner = i;
+    if (winner >= 0)
+      portfolio.winner.store (winner);
+    finished.clear ();
+    waiting = 0;
+    epoch++;
+    synchronized.notify_all ();
+  }
+
+  void synchronize () {
+    std::unique_lock<std::mutex> guard (lock);
+    const int64_t current = epoch;
+    if (++waiting == running)
+      complete ();
+    else
+      synchronized.wait (guard, [&] { return epoch != current; });
+  }
+
+  void finish (int i) {
+    std::lock_guard<std::mutex> guard (lock);
+    finished.push_back (i);
+    if (waiting == --running)
+      complete ();
+  }
+};
+
+class Epoch : public Terminator {
+  Epochs &epochs;
+  const int64_t *ticks; // Search ticks of the solver.
+  int64_t end;
+
+public:
+  Epoch (Epochs &e, const int64_t *t)
+      : epochs (e), ticks (t), end (e.length) {}
+  bool terminate () {
+    Portfolio &portfolio = epochs.portfolio;
+    while (!portfolio.terminate () && ticks[0] + ticks[1] >= end) {
+      epochs.synchronize ();
+      end += epochs.length;
+    }
+    return portfolio.terminate ();
+  }
+};
+
+int App::solve_portfolio (int conflict_limit, int decision_limit) {
+  static const char *configs[] = {"sat", "unsat", "plain"};
+  const int num_configs = sizeof configs / sizeof *configs;
+  vector<Solver *> solvers;
+  solvers.push_back (solver);
+  for (int i = 1; i < threads; i++) {
+    Solver *copy = new Solver ();
+    solver->copy (*copy);
+    Options &opts = copy->internal->opts;
+    if (i <= num_configs)
+      Config::set (opts, configs[i - 1]);
+    else {
+      opts.seed = i;
+      opts.shuffle = 1;
+      opts.shufflerandom = 1;
+    }
+    opts.quiet = 1;
+    opts.report = 0;
+    opts.verbose = 0;
+    if (conflict_limit >= 0)
+      (void) copy->limit ("conflicts", conflict_limit);
+    if (decision_limit >= 0)
+      (void) copy->limit ("decisions", decision_limit);
+    if (i <= num_configs)
+      solver->message ("thread %d uses configuration '%s'", i,
+                       configs[i - 1]);
+    else
+      solver->message ("thread %d uses shuffled variables with seed %d", i,
+                       i);
+    solvers.push_back (copy);
+  }
+  Portfolio portfolio (timesup);
+  Sharing sharing (threads, solver->internal);
+  vector<Share *> shares;
+  for (int i = 0; i < threads; i++) {
+    Share *share = new Share (sharing, i, max_var, epoch_ticks);
+    Solver *s = solvers[i];
+    s->internal->opts.exportglue = s->get ("reducetier1glue");
+    s->connect_learner (share);
+    s->connect_importer (share);
+    shares.push_back (share);
+  }
+  vector<int> results (threads, 0);
+  Epochs epochs (portfolio, shares, results, epoch_ticks);
+  auto run = [&] (int i) {
+    Solver *s = solvers[i];
+    Epoch epoch (epochs, s->internal->stats.ticks.search);
+    if (epoch_ticks)
+      s->connect_terminator (&epoch);
+    else
+      s->connect_terminator (&portfolio);
+    const int res = s->solve ();
+    s->disconnect_terminator ();
+    sharing.retire (i);
+    results[i] = res;
+    if (epoch_ticks)
+      epochs.finish (i);
+    else if (res) {
+      int expected = -1;
+      portfolio.winner.compare_exchange_strong (expected, i);
+    }
+  };
+  vector<std::thread> workers;
+  for (int i = 1; i < threads; i++)
+    workers.push_back (std::thread (run, i));
+  run (0);
+  for (auto &worker : workers)
+    worker.join ();
+  for (int i = 0; i < threads; i++) {
+    solvers[i]->disconnect_learner ();
+    solvers[i]->disconnect_importer ();
+    delete shares[i];
+  }
+  solver->message ("shared %zu clauses", sharing.clauses);
+  if (sharing.recycled)
+    solver->message ("recycled %zu shared clauses", sharing.recycled);
+  if (sharing.dropped)
+    solver->message ("dropped %zu clauses with full sharing buffer",
+                     sharing.dropped);
+  const int winner = portfolio.winner.load ();
+  solver->message ("%d solver threads finished", threads);
+  // Without a winner (due to limits, time-out or signals) the original
+  // solver is kept.  All other copies are deleted in both cases.
+  //
+  const int kept = winner < 0 ? 0 : winner;
+  if (winner >= 0)
+    solver->message ("thread %d won with result %d", winner,
+                     results[winner]);
+  if (kept) {
+    Options &opts = solvers[kept]->internal->opts;
+    opts.quiet = get ("quiet");
+    opts.report = get ("report");
+    opts.verbose = get ("verbose");
+  }
+  for (int i = 0; i < threads; i++)
+    if (i != kept)
+      delete solvers[i];
+  solver = solvers[kept];
+  return winner < 0 ? 0 : results[winner];
+}
+
+/*------------------------------------------------------------------------*/
+
+// In-process cube-and-conquer.  The formula is split by lookahead into
+// cubes of depth 'cube_depth' (see 'Solver::generate_cubes').  Then
+// 'threads' incremental solvers, the original one and copies made after
+// splitting, repeatedly grab the next unsolved cube from a common work
+// counter and solve the formula under the cube as assumptions.  This
+// balances the load dynamically, as cheap cubes are simply followed by
+// more cubes.  Each solver keeps what it learned for the remaining cubes.
+// It further adds the negation of the failed literals of unsatisfiable
+// cubes as clause, which is also shared with all other solvers together
+// with their learned clauses (see 'Sharing' above).  The first satisfiable
+// cube stops all solvers through the 'Portfolio' terminator.
+
+// The conflict and decision limits ('-c' and '-d') are global budgets for
+// all cubes.  Each cube is solved with the remaining budget, which is then
+// reduced by the conflicts and decisions used for that cube.  No further
+// cubes are started after the budget is exhausted.  Cubes solved at the
+// same time can together exceed it by at most the budget remaining when
+// they were started (thus at most by a factor of the number of threads).
+
+struct Cube {
+  vector<int> literals;
+  int thread, status;
+  double time;
+  Cube (const vector<int> &l)
+      : literals (l), thread (-1), status (0), time (0) {}
+};
+
+int App::solve_cubes (int conflict_limit, int decision_limit) {
+  if (get ("report") < 2 && !get ("verbose"))
+    set ("report", 0);
+  const double start = absolute_real_time ();
+  const auto generated = solver->generate_cubes (cube_depth);
+  solver->message ("generated %zu cubes of depth %d in %.2f sec",
+                   generated.cubes.size (), cube_depth,
+                   absolute_real_time () - start);
+  if (generated.status || generated.cubes.empty ()) {
+    solver->message ("solved during cube generation");
+    return solver->solve ();
+  }
+  vector<Cube> cubes;
+  for (const auto &literals : generated.cubes)
+    cubes.push_back (Cube (literals));
+  const size_t num_cubes = cubes.size ();
+  vector<Solver *> solvers;
+  solvers.push_back (solver);
+  for (int i = 1; i < threads; i++) {
+    Solver *copy = new Solver ();
+    solver->copy (*copy);
+    Options &opts = copy->internal->opts;
+    opts.quiet = 1;
+    opts.report = 0;
+    opts.verbose = 0;
+    solvers.push_back (copy);
+  }
+  Portfolio portfolio (timesup);
+  Sharing sharing (threads, solver->internal);
+  vector<Share *> shares;
+  if (threads > 1)
+    for (int i = 0; i < threads; i++) {
+      Share *share = new Share (sharing, i, max_var, false);
+      Solver *s = solvers[i];
+      s->internal->opts.exportglue = s->get ("reducetier1glue");
+      s->connect_learner (share);
+      s->connect_importer (share);
+      shares.push_back (share);
+    }
+  std::atomic<size_t> next (0);
+  std::atomic<int64_t> conflicts (conflict_limit);
+  std::atomic<int64_t> decisions (decision_limit);
+  std::atomic<bool> exhausted (false);
+  auto run = [&] (int i) {
+    Solver *s = solvers[i];
+    s->connect_terminator (&portfolio);
+    vector<int> clause;
+    size_t j;
+    while (!portfolio.terminate () && (j = next++) < num_cubes) {
+      const int64_t conflicts_left = conflicts.load ();
+      const int64_t decisions_left = decisions.load ();
+      if ((conflict_limit >= 0 && conflicts_left <= 0) ||
+          (decision_limit >= 0 && decisions_left <= 0)) {
+        exhausted = true;
+        break;
+      }
+      Cube &cube = cubes[j];
+      for (const auto &lit : cube.literals)
+        s->assume (lit);
+      if (conflict_limit >= 0)
+        (void) s->limit ("conflicts", (int) conflicts_left);
+      if (decision_limit >= 0)
+        (void) s->limit ("decisions", (int) decisions_left);
+      const int64_t conflicts_before = s->get_statistic_value ("conflicts");
+      const int64_t decisions_before = s->get_statistic_value ("decisions");
+      const double started = absolute_real_time ();
+      const int res = s->solve ();
+      cube.time = absolute_real_time () - started;
+      if (conflict_limit >= 0)
+        conflicts -=
+            s->get_statistic_value ("conflicts") - conflicts_before;
+      if (decision_limit >= 0)
+        decisions -=
+            s->get_statistic_value ("decisions") - decisions_before;
+      cube.thread = i;
+      cube.status = res;
+      if (res == 10) {
+        int expected = -1;
+        portfolio.winner.compare_exchange_strong (expected, i);
+      } else if (res == 20) {
+        for (const auto &lit : cube.literals)
+          if (s->failed (lit))
+            clause.push_back (-lit);
+        for (const auto &lit : clause)
+          s->add (lit);
+        s->add (0);
+        if (threads > 1)
+          sharing.share (i, clause);
+        clause.clear ();
+      }
+    }
+    sharing.retire (i);
+  };
+  vector<std::thread> workers;
+  for (int i = 1; i < threads; i++)
+    workers.push_back (std::thread (run, i));
+  run (0);
+  for (auto &worker : workers)
+    worker.join ();
+  for (size_t i = 0; i < shares.size (); i++) {
+    solvers[i]->disconnect_learner ();
+    solvers[i]->disconnect_importer ();
+    delete shares[i];
+  }
+  const double wall = absolute_real_time () - start;
+
+  size_t solved = 0, satisfiable = 0, unsatisfiable = 0;
+  double sum = 0, max = 0;
+  for (size_t j = 0; j < num_cubes; j++) {
+    const Cube &cube = cubes[j];
+    if (cube.thread < 0)
+      continue;
+    const char *status_str;
+    if (cube.status == 10)
+      status_str = "SATISFIABLE", satisfiable++;
+    else if (cube.status == 20)
+      status_str = "UNSATISFIABLE", unsatisfiable++;
+    else
+      status_str = "inconclusive";
+    solved++;
+    sum += cube.time;
+    if (cube.time > max)
+      max = cube.time;
+    solver->message ("cube %zu %-13s thread %d in %.3f sec", j + 1,
+                     status_str, cube.thread, cube.time);
+  }
+  solver->section ("cube-and-conquer summary");
+  if (exhausted)
+    solver->message ("conflict or decision limit exhausted");
+  solver->message ("%zu cubes solved %.0f%%", solved,
+                   percent (solved, num_cubes));
+  solver->message ("%zu cubes unsatisfiable %.0f%%", unsatisfiable,
+                   percent (unsatisfiable, solved));
+  solver->message ("%zu cubes satisfiable %.0f%%", satisfiable,
+                   percent (satisfiable, solved));
+  solver->message ("%.3f sec per cube on average, %.3f sec maximum",
+                   relative (sum, solved), max);
+  solver->message ("%.2f sec cube time in %.2f sec wall time (%.1f "
+                   "parallel)",
+                   sum, wall, relative (sum, wall));
+  if (threads > 1)
+    solver->message ("shared %zu clauses", sharing.clauses);
+
+  const int winner = portfolio.winner.load ();
+  int res = 0;
+  if (winner >= 0)
+    res = 10;
+  else if (unsatisfiable == num_cubes)
+    res = 20;
+  if (winner > 0) {
+    Options &opts = solvers[winner]->internal->opts;
+    opts.quiet = get ("quiet");
+    opts.report = get ("report");
+    opts.verbose = get ("verbose");
+  }
+  const int keep = winner > 0 ? winner : 0;
+  for (int i = 0; i < threads; i++)
+    if (i != keep)
+      delete solvers[i];
+  solver = solvers[keep];
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 // The real initialization is delayed.
 
 void App::init () {
@@ -948,6 +1622,9 @@ void App::init () {
   force_writing = false;
   max_var = 0;
   timesup = false;
+  threads = 1;
+  epoch_ticks = 0;
+  cube_depth = 0;
 
   // Call 'new Solver' only after setting 'reportdefault' and do not
   // add this call to the member initialization above. This is because for
@@ -227,6 +227,7 @@ struct External;
 // Forward declaration of call-back classes. See bottom of this file.
 
 class Learner;
+class Importer;
 class FixedAssignmentListener;
 class Terminator;
 class ClauseIterator;
@@ -401,6 +402,18 @@ public:
   void connect_fixed_listener (FixedAssignmentListener *fixed_listener);
   void disconnect_fixed_listener ();
 
+  // Add call-back which allows to import clauses learned elsewhere, e.g.,
+  // by other solvers working on the same formula.  These clauses are
+  // imported at restarts and added as redundant clauses.  They have to be
+  // implied by the formula.  Since they can not be justified in a proof,
+  // nothing is imported while proof tracing or checking is enabled.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void connect_importer (Importer *importer);
+  void disconnect_importer ();
+
   // ====== BEGIN IPASIR-UP ================================================
 
   // Add call-back which allows to learn, propagate and backtrack based on
@@ -640,6 +653,27 @@ public:
   //
   int64_t get_statistic_value (const char *const) const;
 
+  // A snapshot of the most important counters, which is published by the
+  // search loop every 'progressint' conflicts and when it stops.  Unlike
+  // all other functions this one is thread-safe and lock-free, thus can be
+  // called from another thread while 'solve' runs, e.g., to monitor the
+  // progress of the solver.  It does not require any state and returns
+  // zero counters if nothing has been published yet.
+  //
+  struct Progress {
+    int64_t conflicts;    // Number of conflicts.
+    int64_t decisions;    // Number of decisions.
+    int64_t propagations; // Number of search propagations.
+    int64_t fixed;        // Number of root-level fixed variables.
+    int64_t eliminated;   // Number of eliminated variables.
+    int64_t active;       // Number of active variables.
+    int64_t irredundant;  // Number of active irredundant clauses.
+    int64_t redundant;    // Number of active redundant clauses.
+    int64_t memory;       // Current resident set size in bytes.
+  };
+
+  Progress progress () const;
+
 #ifndef NTRACING
   //------------------------------------------------------------------------
   // This function can be used to write API calls to a file.  The same
@@ -1025,6 +1059,14 @@ public:
   //
   const char *write_extension (const char *path);
 
+  // Write the conflict analysis profile gathered if the 'cprofile' option
+  // is set (histograms of per-conflict costs and the most often analyzed
+  // reason clauses) to a file in JSON format.
+  //
+  // Returns zero if successful and otherwise an error message.
+  //
+  const char *write_conflict_profile (const char *path);
+
   // Print build configuration to a file with prefix 'c '.  If the file
   // is '<stdout>' or '<stderr>' then terminal color codes might be used.
   //
@@ -1235,6 +1277,20 @@ public:
   virtual void learn (int lit) = 0;
 };
 
+// Connected importers provide clauses to be imported.  As long 'importing'
+// returns true there is another clause to import, whose literals are then
+// obtained by calling 'import' until it returns zero.  The solver reads
+// every announced clause completely before calling 'importing' again, thus
+// 'importing' may load the next clause (and has to announce each clause
+// only once).
+
+class Importer {
+public:
+  virtual ~Importer () {}
+  virtual bool importing () = 0;
+  virtual int import () = 0;
+};
+
 // Connected listener gets notified whenever the truth value of a variable
 // is fixed (for example during inprocessing or due to derived unit
 // clauses).
@@ -222,10 +222,33 @@ inline void Internal::flush_watches (int lit, Watches &saved) {
   for (const auto &w : saved)
     ws.push_back (w);
   saved.clear ();
-  shrink_vector (ws);
+  shrink_sparse_vector (ws);
 }
 
+// With 'collectthreads' every thread flushes the lists of a range of
+// variables.  The lists are independent and flushing only reads the
+// clauses, thus the result is the same as flushing them sequentially.
+
 void Internal::flush_all_occs_and_watches () {
+  const size_t threads =
+      min ((size_t) opts.collectthreads, (size_t) max_var);
+  if (threads > 1) {
+    const bool flush_occs_too = occurring ();
+    const bool flush_watches_too = watching ();
+    pool.run (threads, [&] (size_t worker) {
+      const int begin = 1 + max_var * (int64_t) worker / threads;
+      const int end = 1 + max_var * (int64_t) (worker + 1) / threads;
+      Watches tmp;
+      for (int idx = begin; idx != end; idx++) {
+        if (flush_occs_too)
+          flush_occs (idx), flush_occs (-idx);
+        if (flush_watches_too)
+          flush_watches (idx, tmp), flush_watches (-idx, tmp);
+      }
+    });
+    return;
+  }
+
   if (occurring ())
     for (auto idx : vars)
       flush_occs (idx), flush_occs (-idx);
@@ -306,11 +329,18 @@ void Internal::delete_garbage_clauses () {
 // This is the start of the copying garbage collector using the arena.  At
 // the core is the following function, which copies a clause to the 'to'
 // space of the arena.  Be careful if this clause is a reason of an
-// assignment.  In that case update the reason reference.
+// assignment.  In that case update the reason reference.  With
+// 'collectthreads' the clause is only scheduled to be copied later by
+// 'copy_moving_clauses'.
 //
 void Internal::copy_clause (Clause *c) {
   LOG (c, "moving");
   assert (!c->moved);
+  if (opts.collectthreads > 1) {
+    c->moved = true;
+    moving.push_back (c);
+    return;
+  }
   char *p = (char *) c;
   char *q = arena.copy (p, c->bytes ());
   c->copy = (Clause *) q;
@@ -319,6 +349,68 @@ void Internal::copy_clause (Clause *c) {
        (void *) c->copy);
 }
 
+// Copy the clauses scheduled by 'copy_clause' in parallel.  Every thread
+// copies a consecutive range of them to the 'to' space starting at the
+// prefix sum of the bytes of the ranges before.  Thus the clauses end up in
+// the same order and at the same addresses as if copied sequentially.  The
+// 'copy' pointer overlays the 'id' and is only set after copying.
+
+void Internal::copy_moving_clauses () {
+  const size_t size = moving.size ();
+  if (!size)
+    return;
+  const size_t threads = min ((size_t) opts.collectthreads, size);
+  vector<size_t> offsets (threads + 1, 0);
+  pool.run (threads, [&] (size_t worker) {
+    const size_t begin = size * worker / threads;
+    const size_t end = size * (worker + 1) / threads;
+    size_t bytes = 0;
+    for (size_t i = begin; i != end; i++)
+      bytes += moving[i]->bytes ();
+    offsets[worker + 1] = bytes;
+  });
+  for (size_t worker = 0; worker != threads; worker++)
+    offsets[worker + 1] += offsets[worker];
+  char *start = arena.reserve (offsets[threads]);
+  pool.run (threads, [&] (size_t worker) {
+    const size_t begin = size * worker / threads;
+    const size_t end = size * (worker + 1) / threads;
+    char *q = start + offsets[worker];
+    for (size_t i = begin; i != end; i++) {
+      Clause *c = moving[i];
+      assert (c->moved);
+      const size_t bytes = c->bytes ();
+      memcpy (q, (char *) c, bytes);
+      Clause *d = (Clause *) q;
+      d->moved = false;
+      c->copy = d;
+      q += bytes;
+    }
+  });
+  LOG ("copied %zu clauses with %zu threads", size, threads);
+  erase_vector (moving);
+}
+
+// Copy the clauses watched by 'lit' in watch list order.  The clauses are
+// scattered in memory and checking whether they are already moved or are
+// garbage is the dominating cost of the watch based copying policies, as
+// the actual copying is a sequential write (or done in parallel).  Thus we
+// prefetch the clause headers a few watches ahead to overlap these cache
+// misses.
+
+void Internal::copy_watched_clauses (int lit) {
+  const int distance = 4;
+  const Watches &ws = watches (lit);
+  const auto end = ws.end ();
+  for (auto i = ws.begin (); i != end; i++) {
+    if (end - i > distance)
+      __builtin_prefetch (i[distance].clause, 0, 1);
+    Clause *c = i->clause;
+    if (!c->moved && !c->collect ())
+      copy_clause (c);
+  }
+}
+
 // This is the moving garbage collector.
 
 void Internal::copy_non_garbage_clauses () {
@@ -378,9 +470,7 @@ void Internal::copy_non_garbage_clauses () {
 
     for (int sign = -1; sign <= 1; sign += 2)
       for (auto idx : vars)
-        for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+        copy_watched_clauses (sign * likely_phase (idx));
 
   } else {
 
@@ -394,9 +484,7 @@ void Internal::copy_non_garbage_clauses () {
 
     for (int sign = -1; sign <= 1; sign += 2)
       for (int idx = queue.last; idx; idx = link (idx).prev)
-        for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+        copy_watched_clauses (sign * likely_phase (idx));
   }
 
   // Do not forget to move clauses which are not watched, which happened in
@@ -406,6 +494,7 @@ void Internal::copy_non_garbage_clauses () {
     if (!c->collect () && !c->moved)
       copy_clause (c);
 
+  copy_moving_clauses ();
   flush_all_occs_and_watches ();
   update_reason_references ();
 
@@ -508,7 +597,7 @@ void Internal::remove_garbage_binaries () {
         --j;
       }
       ws.resize (j - ws.begin ());
-      shrink_vector (ws);
+      shrink_sparse_vector (ws);
     }
   }
   delete_garbage_clauses ();
@@ -528,6 +617,7 @@ void Internal::garbage_collection () {
   START (collect);
   report ('G', 1);
   stats.collections++;
+  clear_saved_trail (); // Saved reasons might be moved or deleted.
   mark_satisfied_clauses_as_garbage ();
   if (!protected_reasons)
     protect_reasons ();
@@ -344,6 +344,8 @@ void Internal::compact () {
 
   mapper.map_vector (ftab);
   mapper.map_vector (parents);
+  assert (saved_trail.empty ());
+  mapper.map_vector (saved_positions);
   mapper.map_vector (marks);
   mapper.map_vector (phases.saved);
   mapper.map_vector (phases.forced);
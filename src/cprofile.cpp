@@ -0,0 +1,137 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// See 'cprofile.hpp' for what is recorded.  The ticks of the different
+// phases are incremented directly in 'analyze', 'minimize', 'shrink' and
+// 'bump' if 'opts.cprofile' is set, and are added to the histograms after
+// the conflict has been analyzed (and the clause was learned).
+
+void Internal::cprofile_start () {
+  assert (opts.cprofile);
+  auto &current = cprofile.current;
+  current.analyze = current.minimize = current.shrink = current.bump = 0;
+  current.trail = trail.size ();
+}
+
+void Internal::cprofile_record () {
+  assert (opts.cprofile);
+  const auto &current = cprofile.current;
+  auto &histograms = cprofile.histograms;
+  histograms.analyze.add (current.analyze);
+  histograms.minimize.add (current.minimize);
+  histograms.shrink.add (current.shrink);
+  histograms.bump.add (current.bump);
+  histograms.trail.add (current.trail);
+  cprofile.conflicts++;
+}
+
+// Counting resolved reasons needs one hash table access per reason, which
+// is only acceptable since profiling is optional.  To bound the size of
+// the table only the most analyzed '32 * cprofiletop' reasons are kept if
+// it grows beyond twice that size.  Reasons which are flushed lose their
+// count and thus the top reasons are only approximate, but for reasons
+// which are hot throughout the search this does not matter.
+
+void Internal::cprofile_reason (Clause *c) {
+  assert (opts.cprofile);
+  cprofile.current.analyze++;
+  auto &reasons = cprofile.reasons;
+  CProfileReason &reason = reasons[c->id];
+  reason.analyzed++;
+  reason.size = c->size;
+  reason.glue = c->glue;
+  reason.redundant = c->redundant;
+  const size_t keep = 32 * (size_t) opts.cprofiletop;
+  if (reasons.size () <= 2 * keep)
+    return;
+  vector<pair<int64_t, CProfileReason>> sorted (reasons.begin (),
+                                                reasons.end ());
+  nth_element (sorted.begin (), sorted.begin () + keep, sorted.end (),
+               [] (const pair<int64_t, CProfileReason> &a,
+                   const pair<int64_t, CProfileReason> &b) {
+                 return a.second.analyzed > b.second.analyzed;
+               });
+  sorted.resize (keep);
+  LOG ("flushing %zd less analyzed profiled reasons",
+       reasons.size () - keep);
+  reasons.clear ();
+  reasons.insert (sorted.begin (), sorted.end ());
+}
+
+/*------------------------------------------------------------------------*/
+
+static bool write_cprofile_histogram (File *file, const char *name,
+                                      const CHistogram &histogram,
+                                      bool last) {
+  bool res = file->put ("    \"") && file->put (name) &&
+             file->put ("\": {\"sum\": ") && file->put (histogram.sum) &&
+             file->put (", \"max\": ") && file->put (histogram.max) &&
+             file->put (", \"buckets\": [");
+  bool first = true;
+  for (unsigned i = 0; res && i < CHistogram::size; i++) {
+    const int64_t count = histogram.buckets[i];
+    if (!count)
+      continue;
+    const int64_t min = i ? (int64_t) 1 << (i - 1) : 0;
+    const int64_t max = i ? (int64_t) (((uint64_t) 1 << i) - 1) : 0;
+    res = (first || file->put (", ")) && file->put ("{\"min\": ") &&
+          file->put (min) && file->put (", \"max\": ") && file->put (max) &&
+          file->put (", \"count\": ") && file->put (count) &&
+          file->put ('}');
+    first = false;
+  }
+  return res && file->put ("]}") && file->put (last ? "\n" : ",\n");
+}
+
+// Write the profile in JSON format, with the 'cprofiletop' most analyzed
+// reasons sorted by decreasing count (and clause identifier for ties).
+
+bool Internal::write_cprofile (File *file) {
+  const auto &histograms = cprofile.histograms;
+  vector<pair<int64_t, CProfileReason>> top (cprofile.reasons.begin (),
+                                             cprofile.reasons.end ());
+  const auto more_analyzed = [] (const pair<int64_t, CProfileReason> &a,
+                                 const pair<int64_t, CProfileReason> &b) {
+    if (a.second.analyzed != b.second.analyzed)
+      return a.second.analyzed > b.second.analyzed;
+    return a.first < b.first;
+  };
+  const size_t size = min (top.size (), (size_t) opts.cprofiletop);
+  partial_sort (top.begin (), top.begin () + size, top.end (),
+                more_analyzed);
+  top.resize (size);
+  bool res = file->put ("{\n  \"conflicts\": ") &&
+             file->put (cprofile.conflicts) &&
+             file->put (",\n  \"histograms\": {\n") &&
+             write_cprofile_histogram (file, "analyze", histograms.analyze,
+                                       false) &&
+             write_cprofile_histogram (file, "minimize",
+                                       histograms.minimize, false) &&
+             write_cprofile_histogram (file, "shrink", histograms.shrink,
+                                       false) &&
+             write_cprofile_histogram (file, "bump", histograms.bump,
+                                       false) &&
+             write_cprofile_histogram (file, "trail", histograms.trail,
+                                       true) &&
+             file->put ("  },\n  \"reasons\": [");
+  bool first = true;
+  for (const auto &entry : top) {
+    if (!res)
+      break;
+    const CProfileReason &reason = entry.second;
+    res = file->put (first ? "\n" : ",\n") && file->put ("    {\"id\": ") &&
+          file->put (entry.first) && file->put (", \"analyzed\": ") &&
+          file->put (reason.analyzed) && file->put (", \"size\": ") &&
+          file->put (reason.size) && file->put (", \"glue\": ") &&
+          file->put (reason.glue) && file->put (", \"redundant\": ") &&
+          file->put (reason.redundant ? "true" : "false") &&
+          file->put ('}');
+    first = false;
+  }
+  return res && file->put (first ? "]\n}\n" : "\n  ]\n}\n");
+}
+
+} // namespace CaDiCaL
@@ -0,0 +1,78 @@
+#ifndef _cprofile_hpp_INCLUDED
+#define _cprofile_hpp_INCLUDED
+
+#include <unordered_map>
+
+namespace CaDiCaL {
+
+// Optional instrumentation of conflict analysis enabled with 'cprofile'.
+// For every learned clause we record how expensive it was to derive it
+// ('analyze'), to minimize it ('minimize'), to shrink it ('shrink') and to
+// bump its variables ('bump') as well as the trail length at the conflict.
+// Costs are measured in 'ticks', which here are visited reason clauses and
+// bumped variables (independent of 'minimizeticks').  These values are
+// added to histograms with logarithmic buckets.  We further count for each
+// reason clause how often it was resolved during conflict analysis in
+// order to find the hottest reasons.  All of this can be written as JSON
+// with 'Solver::write_conflict_profile'.
+
+struct CHistogram {
+
+  // Bucket zero counts zero values and bucket 'i > 0' the values in the
+  // interval '[2^(i-1), 2^i - 1]'.
+  //
+  static const unsigned size = 64;
+
+  int64_t buckets[size];
+  int64_t sum, max;
+
+  CHistogram () : sum (0), max (0) {
+    for (auto &bucket : buckets)
+      bucket = 0;
+  }
+
+  void add (int64_t value) {
+    unsigned i = 0;
+    for (uint64_t tmp = value; tmp; tmp >>= 1)
+      i++;
+    buckets[i]++;
+    sum += value;
+    if (value > max)
+      max = value;
+  }
+};
+
+struct CProfileReason {
+  int64_t analyzed; // Resolved in conflict analysis that often.
+  int size, glue;   // Of the clause when it was last resolved.
+  bool redundant;
+};
+
+struct ConflictProfile {
+
+  // Ticks and trail length of the current conflict.
+  //
+  struct {
+    int64_t analyze, minimize, shrink, bump, trail;
+  } current;
+
+  struct {
+    CHistogram analyze, minimize, shrink, bump, trail;
+  } histograms;
+
+  int64_t conflicts; // Number of recorded conflicts.
+
+  // Resolved reason clauses indexed by clause identifier.  Since clause
+  // pointers change during garbage collection we use the identifiers,
+  // which also stay unique after a clause is deleted.  In order to bound
+  // the memory usage the least analyzed reasons are flushed if the table
+  // becomes too large (see 'cprofile_reason').
+  //
+  std::unordered_map<int64_t, CProfileReason> reasons;
+
+  ConflictProfile () : current{0, 0, 0, 0, 0}, conflicts (0) {}
+};
+
+} // namespace CaDiCaL
+
+#endif
@@ -1,5 +1,7 @@
 #include "internal.hpp"
 
+#include <atomic>
+
 namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
@@ -468,6 +470,16 @@ bool Internal::elim_resolvents_are_bounded (Eliminator &eliminator,
 
   stats.elimtried++;
 
+  const ElimCheck *check = eliminator.check;
+  if (check && check->result && !substitute && !resolve_gates &&
+      check->pivot == pivot && check->fixed == stats.all.fixed) {
+    LOG ("resolvents on %d counted in parallel", pivot);
+    stats.elimcheckused++;
+    stats.elimres += check->resolutions;
+    stats.elimrestried += check->resolutions;
+    return check->result == CHECK_BOUNDED;
+  }
+
   assert (!unsat);
   assert (active (pivot));
 
@@ -733,6 +745,272 @@ void Internal::try_to_eliminate_variable (Eliminator &eliminator, int pivot,
 
 /*------------------------------------------------------------------------*/
 
+// Counting the resolvents of a candidate is the main cost of elimination
+// and, apart from its side effects, only reads clauses and root level
+// values.  Thus with 'opts.elimthreads' positive we count resolvents of a
+// whole batch of candidates in parallel before trying to eliminate them in
+// the usual sequential order.  The batch starts with the current candidate
+// followed by candidates at the top of the schedule, whose neighbourhoods
+// (variables occurring in clauses with the candidate) are pairwise
+// disjoint.  Trying to eliminate one candidate can then not change the
+// clauses of the others, unless new units are derived.
+//
+// The workers mimic 'try_to_eliminate_variable' and
+// 'elim_resolvents_are_bounded' exactly (same pivot, order of occurrences,
+// resolution limits and early aborts), but give up ('CHECK_UNKNOWN') as
+// soon as sequential counting would have a side effect.  Such candidates
+// and those for which gates are found are counted sequentially as before.
+// As a consequence the result of elimination does not depend on the number
+// of threads and is identical to the purely sequential one.
+
+// Returns the size of the resolvent, zero if it is tautological and a
+// negative number if sequential resolution would have side effects.
+
+static int elim_check_resolvent (const Internal *internal, Clause *c,
+                                 int pivot, Clause *d,
+                                 vector<signed char> &marks) {
+  if (c->size > d->size) {
+    pivot = -pivot;
+    swap (c, d);
+  }
+  int s = 0, t = 0, size = 0;
+  bool satisfied = false;
+  for (const auto &lit : *c) {
+    if (lit == pivot) {
+      s++;
+      continue;
+    }
+    const signed char tmp = internal->val (lit);
+    if (tmp > 0) {
+      satisfied = true;
+      break;
+    } else if (!tmp)
+      marks[abs (lit)] = sign (lit), s++, size++;
+  }
+  bool tautological = false;
+  if (!satisfied) {
+    for (const auto &lit : *d) {
+      if (lit == -pivot) {
+        t++;
+        continue;
+      }
+      const signed char tmp = internal->val (lit);
+      if (tmp > 0) {
+        satisfied = true;
+        break;
+      } else if (tmp < 0)
+        continue;
+      const signed char mark = marks[abs (lit)] * sign (lit);
+      if (mark < 0) {
+        tautological = true;
+        break;
+      } else if (!mark)
+        size++;
+      t++;
+    }
+  }
+  for (const auto &lit : *c)
+    marks[abs (lit)] = 0;
+  if (satisfied)
+    return -1;
+  if (tautological)
+    return 0;
+  if (size < 2 || s > size || t > size)
+    return -1;
+  return size;
+}
+
+void Internal::elim_check_resolvents (ElimCheck &check,
+                                      vector<signed char> &marks) {
+  vector<Clause *> ps, ns;
+  for (const auto &c : occs (check.pivot))
+    if (!c->collect ())
+      ps.push_back (c);
+  for (const auto &c : occs (-check.pivot))
+    if (!c->collect ())
+      ns.push_back (c);
+  if (ps.size () > ns.size ()) {
+    check.pivot = -check.pivot;
+    swap (ps, ns);
+  }
+  const int64_t pos = ps.size ();
+  const int64_t neg = ns.size ();
+  if (!pos || neg > opts.elimocclim)
+    return;
+  stable_sort (ps.begin (), ps.end (), clause_smaller_size ());
+  stable_sort (ns.begin (), ns.end (), clause_smaller_size ());
+  const int64_t bound = pos + neg + lim.elimbound;
+  int64_t resolvents = 0;
+  for (const auto &c : ps) {
+    if (c->garbage)
+      continue;
+    for (const auto &d : ns) {
+      if (d->garbage)
+        continue;
+      check.resolutions++;
+      const int size =
+          elim_check_resolvent (this, c, check.pivot, d, marks);
+      if (size < 0)
+        return;
+      if (!size)
+        continue;
+      resolvents++;
+      if (size > opts.elimclslim || resolvents > bound) {
+        check.result = CHECK_UNBOUNDED;
+        return;
+      }
+    }
+  }
+  check.result = CHECK_BOUNDED;
+}
+
+void Internal::elim_check_candidates (Eliminator &eliminator, int idx) {
+  const size_t threads = opts.elimthreads;
+  const size_t batch = 8 * threads;
+  vector<ElimCheck> &checks = eliminator.checks;
+  vector<int64_t> &claimed = eliminator.claimed;
+  const int64_t first = eliminator.claims + 1;
+
+  // Claims all variables in 'vars' (removing duplicates) for a new
+  // candidate unless one of them is already claimed in this batch.
+  //
+  auto claim = [&] (vector<int> &vars) {
+    const int64_t stamp = ++eliminator.claims;
+    size_t j = 0;
+    for (const auto &var : vars) {
+      const int64_t previous = claimed[var];
+      if (previous == stamp)
+        continue;
+      if (previous >= first) {
+        for (size_t k = 0; k < j; k++)
+          claimed[vars[k]] = 0;
+        return false;
+      }
+      claimed[var] = stamp;
+      vars[j++] = var;
+    }
+    vars.resize (j);
+    return true;
+  };
+
+  // Candidates with too many occurrences are not tried anyhow.
+  //
+  auto checkable = [&] (int candidate) {
+    if (!active (candidate) || frozen (candidate))
+      return false;
+    if ((int64_t) occs (candidate).size () > opts.elimocclim)
+      return false;
+    if ((int64_t) occs (-candidate).size () > opts.elimocclim)
+      return false;
+    return true;
+  };
+  if (!checkable (idx))
+    return;
+
+  vector<int> neighbours;
+  auto add = [&] (int candidate) {
+    if (!checkable (candidate))
+      return;
+    assert (neighbours.empty ());
+    for (int lit = -candidate; lit <= candidate; lit += 2 * candidate)
+      for (const auto &c : occs (lit))
+        if (!c->garbage)
+          for (const auto &other : *c)
+            neighbours.push_back (abs (other));
+    if (!claim (neighbours)) {
+      neighbours.clear ();
+      return;
+    }
+    checks.push_back (ElimCheck ());
+    ElimCheck &check = checks.back ();
+    check.pivot = candidate;
+    check.result = CHECK_UNKNOWN;
+    check.resolutions = 0;
+    check.tries = eliminator.tries;
+    check.fixed = stats.all.fixed;
+    check.neighbours.swap (neighbours);
+  };
+
+  // The current candidate comes first.  Then we keep the valid checks of
+  // the previous batch of candidates not tried yet, as long their
+  // neighbourhood is disjoint from the one of the current candidate.
+  //
+  vector<ElimCheck> previous, current;
+  previous.swap (checks);
+  add (idx);
+  current.swap (checks);
+  for (auto &check : previous)
+    if (eliminator.schedule.contains (abs (check.pivot)) &&
+        elim_valid_check (eliminator, check) && claim (check.neighbours))
+      checks.push_back (std::move (check));
+  const size_t kept = checks.size ();
+  for (auto &check : current)
+    checks.push_back (std::move (check));
+  size_t scanned = 0;
+  for (const auto &candidate : eliminator.schedule) {
+    if (checks.size () >= batch || scanned++ >= 4 * batch)
+      break;
+    add (candidate);
+  }
+
+  // Then count resolvents of the new candidates in parallel.
+  //
+  const size_t size = checks.size ();
+  const size_t workers = min (threads, size - kept);
+  while (eliminator.marks.size () < workers)
+    eliminator.marks.push_back (vector<signed char> (max_var + 1, 0));
+  std::atomic<size_t> next (kept);
+  pool.run (workers, [&] (size_t worker) {
+    vector<signed char> &marks = eliminator.marks[worker];
+    size_t i;
+    while ((i = next++) < size)
+      elim_check_resolvents (checks[i], marks);
+  });
+  stats.elimchecked += size - kept;
+}
+
+// A check remains valid as long no variable in the neighbourhood of the
+// candidate was touched and no new unit was derived.
+
+bool Internal::elim_valid_check (Eliminator &eliminator,
+                                 const ElimCheck &check) {
+  if (check.fixed != stats.all.fixed)
+    return false;
+  for (const auto &neighbour : check.neighbours)
+    if (eliminator.touched[neighbour] > check.tries)
+      return false;
+  return true;
+}
+
+const ElimCheck *Internal::elim_find_check (Eliminator &eliminator,
+                                            int idx) {
+  for (const auto &check : eliminator.checks)
+    if (abs (check.pivot) == idx)
+      return elim_valid_check (eliminator, check) ? &check : 0;
+  return 0;
+}
+
+// Called before trying to eliminate the candidate, which provides a valid
+// check for the candidate (counting resolvents of a new batch if needed)
+// and then marks all variables in its neighbourhood as touched.
+
+void Internal::elim_prepare_candidate (Eliminator &eliminator, int idx) {
+  const ElimCheck *check = elim_find_check (eliminator, idx);
+  if (!check) {
+    elim_check_candidates (eliminator, idx);
+    check = elim_find_check (eliminator, idx);
+  }
+  eliminator.check = check;
+  const int64_t tries = ++eliminator.tries;
+  eliminator.touched[idx] = tries;
+  for (int lit = -idx; lit <= idx; lit += 2 * idx)
+    for (const auto &c : occs (lit))
+      for (const auto &other : *c)
+        eliminator.touched[abs (other)] = tries;
+}
+
+/*------------------------------------------------------------------------*/
+
 void Internal::
     mark_redundant_clauses_with_eliminated_variables_as_garbage () {
   for (const auto &c : clauses) {
@@ -877,6 +1155,12 @@ int Internal::elim_round (bool &completed, bool &deleted_binary_clause) {
   //
   const int64_t garbage_limit = (2 * stats.irrlits / 3) + (1 << 20);
 
+  const bool parallel = opts.elimthreads > 0;
+  if (parallel) {
+    eliminator.touched.resize (max_var + 1, 0);
+    eliminator.claimed.resize (max_var + 1, 0);
+  }
+
   // Main loops tries to eliminate variables according to the schedule. The
   // schedule is updated dynamically and variables are potentially
   // rescheduled to be tried again if they occur in a removed clause.
@@ -889,7 +1173,10 @@ int Internal::elim_round (bool &completed, bool &deleted_binary_clause) {
     int idx = schedule.front ();
     schedule.pop_front ();
     flags (idx).elim = false;
+    if (parallel)
+      elim_prepare_candidate (eliminator, idx);
     try_to_eliminate_variable (eliminator, idx, deleted_binary_clause);
+    eliminator.check = 0;
 #ifndef QUIET
     tried++;
 #endif
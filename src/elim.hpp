@@ -26,6 +26,26 @@ struct proof_clause {
 
 enum GateType { NO = 0, EQUI = 1, AND = 2, ITE = 3, XOR = 4, DEF = 5 };
 
+// Outcome of counting the resolvents of an elimination candidate in
+// parallel ('opts.elimthreads').  The result is 'CHECK_UNKNOWN' if counting
+// them sequentially would have side effects, such as removing satisfied
+// clauses, deriving units or strengthening antecedents on-the-fly.
+
+enum ElimCheckResult {
+  CHECK_UNKNOWN = 0,
+  CHECK_BOUNDED = 1,
+  CHECK_UNBOUNDED = 2
+};
+
+struct ElimCheck {
+  int pivot;              // negated if more positive occurrences
+  ElimCheckResult result; // of counting resolvents on 'pivot'
+  int64_t resolutions;    // number of resolutions needed to get 'result'
+  int64_t tries;          // 'Eliminator.tries' at the time of checking
+  int64_t fixed;          // 'stats.all.fixed' at the time of checking
+  vector<int> neighbours; // variables in clauses with 'pivot' or '-pivot'
+};
+
 struct Eliminator {
 
   Internal *internal;
@@ -33,7 +53,7 @@ struct Eliminator {
 
   Eliminator (Internal *i)
       : internal (i), schedule (elim_more (i)), definition_unit (0),
-        gatetype (NO) {}
+        gatetype (NO), check (0), tries (0), claims (0) {}
   ~Eliminator ();
 
   queue<Clause *> backward;
@@ -46,6 +66,17 @@ struct Eliminator {
   vector<proof_clause> proof_clauses;
   vector<int> marked;
   GateType gatetype;
+
+  // Parallel resolvent counting of batches of candidates with disjoint
+  // neighbourhoods.  A check remains valid until a variable in its
+  // neighbourhood is touched by trying to eliminate another variable.
+  //
+  vector<ElimCheck> checks;
+  const ElimCheck *check;            // valid check of current candidate
+  vector<int64_t> touched;           // last try touching variable
+  vector<int64_t> claimed;           // last candidate claiming variable
+  vector<vector<signed char>> marks; // one for each thread
+  int64_t tries, claims;
 };
 
 } // namespace CaDiCaL
@@ -7,7 +7,8 @@ namespace CaDiCaL {
 
 External::External (Internal *i)
     : internal (i), max_var (0), vsize (0), extended (false),
-      concluded (false), terminator (0), learner (0), fixed_listener (0),
+      concluded (false), terminator (0), learner (0), importer (0),
+      fixed_listener (0),
       propagator (0), solution (0), vars (max_var) {
   assert (internal);
   assert (!internal->external);
@@ -1031,4 +1032,78 @@ void External::export_learned_large_clause (const vector<int> &clause) {
     LOG ("not exporting learned clause of size %zu", size);
 }
 
+/*------------------------------------------------------------------------*/
+
+// Import clauses from the importer at the root level.  The clauses are
+// simplified with respect to root level assignments.  Satisfied and
+// tautological clauses as well as clauses with unknown or inactive (for
+// instance eliminated) variables are skipped.  The remaining ones are
+// added as redundant clauses, or assigned if they became units.  The
+// caller already checked that 'importing' returned true and thus the first
+// clause is read without asking again (see 'Importer' in 'cadical.hpp').
+
+void External::import_clauses () {
+  assert (importer);
+  assert (!internal->level);
+  assert (!internal->proof);
+  vector<int> &clause = internal->clause;
+  assert (clause.empty ());
+  do {
+    bool skip = false;
+    int elit;
+    while ((elit = importer->import ())) {
+      if (skip)
+        continue;
+      const int eidx = abs (elit);
+      int ilit = eidx <= max_var ? e2i[eidx] : 0;
+      if (!ilit) {
+        skip = true;
+        continue;
+      }
+      if (elit < 0)
+        ilit = -ilit;
+      const signed char tmp = internal->val (ilit);
+      if (tmp > 0)
+        skip = true;
+      else if (tmp < 0)
+        continue;
+      else if (!internal->active (ilit))
+        skip = true;
+      else {
+        const signed char mark = internal->marked (ilit);
+        if (mark < 0)
+          skip = true;
+        else if (!mark) {
+          internal->mark (ilit);
+          clause.push_back (ilit);
+        }
+      }
+    }
+    for (const auto &lit : clause)
+      internal->unmark (lit);
+    if (skip) {
+      internal->stats.imported.skipped++;
+      LOG (clause, "skipping imported");
+    } else if (clause.empty ()) {
+      LOG ("imported empty clause");
+      internal->stats.imported.units++;
+      internal->learn_empty_clause ();
+    } else if (clause.size () == 1) {
+      LOG ("imported unit %d", clause[0]);
+      internal->stats.imported.units++;
+      internal->assign_unit (clause[0]);
+    } else {
+      const int size = clause.size ();
+      Clause *c = internal->new_clause (true, size - 1);
+      LOG (c, "imported");
+      internal->watch_clause (c);
+      if (size == 2)
+        internal->stats.imported.binaries++;
+      else
+        internal->stats.imported.clauses++;
+    }
+    clause.clear ();
+  } while (!internal->unsat && importer->importing ());
+}
+
 } // namespace CaDiCaL
@@ -101,6 +101,12 @@ struct External {
   void export_learned_unit_clause (int ilit);
   void export_learned_large_clause (const vector<int> &);
 
+  // If there is an importer import clauses at the root level.
+
+  Importer *importer;
+
+  void import_clauses ();
+
   // If there is a listener for fixed assignments.
 
   FixedAssignmentListener *fixed_listener;
@@ -18,6 +18,11 @@ using namespace std;
 // implement the mapping externally provided by another template parameter.
 // Since we use 'UINT_MAX' as 'not contained' flag, we can only have
 // 'UINT_MAX - 1' elements in the heap.
+//
+// By default the heap is binary but the arity can be changed to any power
+// of two (see 'arity').  Heaps with larger arity are flatter, which makes
+// 'up' (as in bumping scores) cheaper, while 'down' (as in 'pop_front')
+// has to compare more children but on the same cache line.
 
 const unsigned invalid_heap_position = UINT_MAX;
 
@@ -26,6 +31,7 @@ template <class C> class heap {
   vector<unsigned> array; // actual binary heap
   vector<unsigned> pos;   // positions of elements in array
   C less;                 // less-than for elements
+  unsigned shift;         // logarithm of arity (1 = binary)
 
   // Map an element to its position entry in the 'pos' map.
   //
@@ -37,29 +43,6 @@ template <class C> class heap {
     return res;
   }
 
-  bool has_parent (unsigned e) { return index (e) > 0; }
-  bool has_left (unsigned e) {
-    return (size_t) 2 * index (e) + 1 < size ();
-  }
-  bool has_right (unsigned e) {
-    return (size_t) 2 * index (e) + 2 < size ();
-  }
-
-  unsigned parent (unsigned e) {
-    assert (has_parent (e));
-    return array[(index (e) - 1) / 2];
-  }
-
-  unsigned left (unsigned e) {
-    assert (has_left (e));
-    return array[2 * index (e) + 1];
-  }
-
-  unsigned right (unsigned e) {
-    assert (has_right (e));
-    return array[2 * index (e) + 2];
-  }
-
   // Exchange elements 'a' and 'b' in 'array' and fix their positions.
   //
   void exchange (unsigned a, unsigned b) {
@@ -71,25 +54,45 @@ template <class C> class heap {
   // Bubble up an element as far as necessary.
   //
   void up (unsigned e) {
-    unsigned p;
-    while (has_parent (e) && less ((p = parent (e)), e))
-      exchange (p, e);
+    size_t i = index (e);
+    while (i) {
+      const size_t j = (i - 1) >> shift;
+      const unsigned p = array[j];
+      if (!less (p, e))
+        break;
+      array[i] = p;
+      pos[p] = (unsigned) i;
+      i = j;
+    }
+    array[i] = e;
+    pos[e] = (unsigned) i;
   }
 
   // Bubble down an element as far as necessary.
   //
   void down (unsigned e) {
-    while (has_left (e)) {
-      unsigned c = left (e);
-      if (has_right (e)) {
-        unsigned r = right (e);
-        if (less (c, r))
-          c = r;
+    const size_t size = array.size ();
+    size_t i = index (e);
+    for (;;) {
+      const size_t first = (i << shift) + 1;
+      if (first >= size)
+        break;
+      const size_t last = min (first + ((size_t) 1 << shift), size);
+      size_t j = first;
+      unsigned c = array[j];
+      for (size_t k = first + 1; k < last; k++) {
+        const unsigned o = array[k];
+        if (less (c, o))
+          j = k, c = o;
       }
       if (!less (e, c))
         break;
-      exchange (e, c);
+      array[i] = c;
+      pos[c] = (unsigned) i;
+      i = j;
     }
+    array[i] = e;
+    pos[e] = (unsigned) i;
   }
 
   // Very expensive checker for the main 'heap' invariant.  Can be enabled
@@ -102,9 +105,10 @@ template <class C> class heap {
 #warning "expensive checking in heap enabled"
     assert (array.size () <= invalid_heap_position);
     for (size_t i = 0; i < array.size (); i++) {
-      size_t l = 2*i + 1, r = 2*i + 2;
-      if (l < array.size ()) assert (!less (array[i], array[l]));
-      if (r < array.size ()) assert (!less (array[i], array[r]));
+      for (size_t k = 1; k <= ((size_t) 1 << shift); k++) {
+        size_t c = (i << shift) + k;
+        if (c < array.size ()) assert (!less (array[i], array[c]));
+      }
       assert (array[i] >= 0);
       {
         assert ((size_t) array[i] < pos.size ());
@@ -120,7 +124,28 @@ template <class C> class heap {
   }
 
 public:
-  heap (const C &c) : less (c) {}
+  heap (const C &c) : less (c), shift (1) {}
+
+  // Logarithm of the arity of the heap.  Changing it rebuilds the heap.
+  //
+  unsigned arity () const { return shift; }
+  void arity (unsigned new_shift) {
+    assert (new_shift > 0);
+    if (new_shift == shift)
+      return;
+    shift = new_shift;
+    rebuild ();
+  }
+
+  // Restore the heap property bottom-up in linear time after 'less' has
+  // changed for many elements at once (instead of calling 'update' for
+  // each of them).
+  //
+  void rebuild () {
+    for (size_t i = array.size (); i--;)
+      down (array[i]);
+    check ();
+  }
 
   // Number of elements in the heap.
   //
@@ -24,16 +24,19 @@ Internal::Internal ()
       propagated2 (0), propergated (0), best_assigned (0),
       target_assigned (0), no_conflict_until (0), unsat_constraint (false),
       marked_failed (true), sweep_incomplete (false),
-      randomized_deciding (false), citten (0), num_assigned (0), proof (0),
-      opts (this),
+      randomized_deciding (false), citten (0),
+      num_assigned (0), proof (0), opts (this),
 #ifndef QUIET
       profiles (this), force_phase_messages (false),
 #endif
       arena (this), prefix ("c "), internal (this), external (0),
-      termination_forced (false), vars (this->max_var),
-      lits (this->max_var) {
+      termination_forced (false), progress_sequence (0),
+      vars (this->max_var), lits (this->max_var) {
   control.push_back (Level (0, 0));
 
+  for (auto &counter : progress_counters)
+    counter.store (0, std::memory_order_relaxed);
+
   // The 'dummy_binary' is used in 'try_to_subsume_clause' to fake a real
   // clause (which then can be used to subsume or strengthen the given
   // clause in one routine for both binary and non binary clauses) and
@@ -132,6 +135,7 @@ void Internal::enlarge (int new_max_var) {
   enlarge_only (wtab, 2 * new_vsize);
   enlarge_only (vtab, new_vsize);
   enlarge_zero (parents, new_vsize);
+  enlarge_zero (saved_positions, new_vsize);
   enlarge_only (links, new_vsize);
   enlarge_zero (btab, new_vsize);
   enlarge_zero (gtab, new_vsize);
@@ -313,6 +317,8 @@ int Internal::cdcl_loop_with_inprocessing () {
       break;                               // decision or conflict limit
     else if (terminated_asynchronously ()) // externally terminated
       break;
+    else if (publishing ())
+      publish_progress (); // snapshot for 'Solver::progress'
     else if (restarting ())
       restart (); // restart by backtracking
     else if (rephasing ())
@@ -331,6 +337,8 @@ int Internal::cdcl_loop_with_inprocessing () {
       res = decide (); // next decision
   }
 
+  publish_progress ();
+
   if (stable) {
     STOP (stable);
     report (']');
@@ -344,6 +352,66 @@ int Internal::cdcl_loop_with_inprocessing () {
   return res;
 }
 
+/*------------------------------------------------------------------------*/
+
+// The progress snapshot is protected by a sequence lock.  The writer makes
+// the sequence number odd, stores the counters and makes it even again.
+// Readers retry until they read the same even sequence number before and
+// after copying the counters.  Since only the solver thread writes, this
+// is lock-free for both sides and never delays the search.
+
+void Internal::publish_progress () {
+  const int64_t counters[] = {
+      stats.conflicts,
+      stats.decisions,
+      stats.propagations.search,
+      stats.all.fixed,
+      stats.all.eliminated + stats.all.fasteliminated,
+      active (),
+      irredundant (),
+      redundant (),
+      (int64_t) current_resident_set_size (),
+  };
+  static_assert (sizeof counters / sizeof *counters ==
+                     sizeof progress_counters / sizeof *progress_counters,
+                 "progress counters mismatch");
+  const uint64_t sequence =
+      progress_sequence.load (std::memory_order_relaxed);
+  progress_sequence.store (sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence (std::memory_order_release);
+  size_t i = 0;
+  for (const auto &counter : counters)
+    progress_counters[i++].store (counter, std::memory_order_relaxed);
+  progress_sequence.store (sequence + 2, std::memory_order_release);
+  lim.progress = stats.conflicts + opts.progressint;
+}
+
+Solver::Progress Internal::progress () const {
+  int64_t counters[sizeof progress_counters / sizeof *progress_counters];
+  uint64_t before, after;
+  do {
+    before = progress_sequence.load (std::memory_order_acquire);
+    size_t i = 0;
+    for (const auto &counter : progress_counters)
+      counters[i++] = counter.load (std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_acquire);
+    after = progress_sequence.load (std::memory_order_relaxed);
+  } while ((before & 1) || before != after);
+  Solver::Progress res;
+  res.conflicts = counters[0];
+  res.decisions = counters[1];
+  res.propagations = counters[2];
+  res.fixed = counters[3];
+  res.eliminated = counters[4];
+  res.active = counters[5];
+  res.irredundant = counters[6];
+  res.redundant = counters[7];
+  res.memory = counters[8];
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 int Internal::propagate_assumptions () {
   if (proof)
     proof->solve_query ();
@@ -953,6 +1021,7 @@ int Internal::solve (bool preprocess_only) {
   assert (clause.empty ());
   stats.searches++;
   START (solve);
+  scores.arity (opts.scorearity); // Rebuilds the heap if changed.
   if (proof)
     proof->solve_query ();
   if (opts.ilb) {
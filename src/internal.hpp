@@ -32,6 +32,7 @@ extern "C" {
 // Common 'C++' headers.
 
 #include <algorithm>
+#include <atomic>
 #include <queue>
 #include <string>
 #include <unordered_set>
@@ -58,6 +59,7 @@ extern "C" {
 #include "congruence.hpp"
 #include "contract.hpp"
 #include "cover.hpp"
+#include "cprofile.hpp"
 #include "decompose.hpp"
 #include "drattracer.hpp"
 #include "elim.hpp"
@@ -83,6 +85,7 @@ extern "C" {
 #include "options.hpp"
 #include "parse.hpp"
 #include "phases.hpp"
+#include "pool.hpp"
 #include "profile.hpp"
 #include "proof.hpp"
 #include "queue.hpp"
@@ -275,6 +278,13 @@ struct Internal {
   bool sweep_incomplete;      // sweep
   uint64_t randomized_deciding;
 
+  // Literals and their reasons undone by the last back-jump in 'analyze'
+  // if 'trailsave' is enabled.  They are replayed in 'propagate'.
+  //
+  vector<int> saved_trail;
+  vector<Clause *> saved_reasons;
+  vector<unsigned> saved_positions; // one plus position in 'saved_trail'
+
   kitten *citten;
 
   size_t num_assigned; // check for satisfied
@@ -282,7 +292,10 @@ struct Internal {
   vector<int> probes;       // remaining scheduled probes
   vector<Level> control;    // 'level + 1 == control.size ()'
   vector<Clause *> clauses; // ordered collection of all clauses
+  vector<Clause *> moving;  // clauses to be copied in parallel
   Averages averages;        // glue, size, jump moving averages
+  ConflictProfile cprofile; // optional conflict analysis profile
+  ThreadPool pool;          // helper threads for parallel checks
   Delay delay[2];           // Delay certain functions
   Delay congruence_delay;   // Delay congruence if not successful recently
   Limit lim;                // limits for various phases
@@ -321,6 +334,13 @@ struct Internal {
   //
   volatile bool termination_forced;
 
+  // Snapshot of counters for 'Solver::progress' which is written by
+  // 'publish_progress' and read concurrently without locking.  The
+  // sequence number is odd while the snapshot is written (sequence lock).
+  //
+  std::atomic<uint64_t> progress_sequence;
+  std::atomic<int64_t> progress_counters[9];
+
   /*----------------------------------------------------------------------*/
 
   const Range vars; // Provides safe variable iteration.
@@ -471,7 +491,8 @@ struct Internal {
   // Variable bumping through exponential VSIDS (EVSIDS) as in MiniSAT.
   //
   bool use_scores () const { return opts.score && stable; }
-  void bump_variable_score (int lit);
+  void bump_variable_score (int lit, bool update = true);
+  void bump_variable_scores_batch ();
   void bump_variable_score_inc ();
   void rescale_variable_scores ();
 
@@ -671,6 +692,7 @@ struct Internal {
   }
 
   void bump_queue (int idx);
+  void bump_queue_batch ();
 
   // Mark (active) variables as eliminated, substituted, pure or fixed,
   // which turns them into inactive variables.
@@ -764,11 +786,24 @@ struct Internal {
   void backtrack (int target_level = 0);
   void backtrack_without_updating_phases (int target_level = 0);
 
+  // Saving the trail undone by back-jumping and replaying it during
+  // propagation ('trailsave').
+  //
+  void save_trail (int new_level);
+  void replay_saved_trail (size_t position, int64_t &ticks);
+  void clear_saved_trail () {
+    for (const auto &lit : saved_trail)
+      saved_positions[vidx (lit)] = 0;
+    saved_trail.clear ();
+    saved_reasons.clear ();
+  }
+
   // Minimized learned clauses in 'minimize.cpp'.
   //
   bool minimize_literal (int lit, int depth = 0);
   void minimize_clause ();
   void calculate_minimize_chain (int lit, std::vector<int> &stack);
+  void minimize_clause_with_binaries (int lit, int &glue);
 
   // Learning from conflicts in 'analyze.cc'.
   //
@@ -805,6 +840,13 @@ struct Internal {
   void analyze ();
   void iterate (); // report learned unit clause
 
+  // Optional profiling of conflict analysis in 'cprofile.cpp'.
+  //
+  void cprofile_start ();
+  void cprofile_record ();
+  void cprofile_reason (Clause *);
+  bool write_cprofile (File *);
+
   // Learning from external propagator in 'external_propagate.cpp'
   //
   bool external_propagate ();
@@ -902,6 +944,12 @@ struct Internal {
 
   bool search_limits_hit ();
 
+  // Publishing and reading the progress snapshot (in 'internal.cpp').
+  //
+  bool publishing () const { return stats.conflicts >= lim.progress; }
+  void publish_progress ();
+  Solver::Progress progress () const;
+
   void terminate () {
     LOG ("forcing asynchronous termination");
     termination_forced = true;
@@ -927,6 +975,8 @@ struct Internal {
   void remove_falsified_literals (Clause *);
   void mark_satisfied_clauses_as_garbage ();
   void copy_clause (Clause *);
+  void copy_moving_clauses ();
+  void copy_watched_clauses (int lit);
   void flush_watches (int lit, Watches &);
   size_t flush_occs (int lit);
   void flush_all_occs_and_watches ();
@@ -966,7 +1016,11 @@ struct Internal {
   void strengthen_clause (Clause *, int);
   void subsume_clause (Clause *subsuming, Clause *subsumed);
   int subsume_check (Clause *subsuming, Clause *subsumed);
-  int try_to_subsume_clause (Clause *, vector<Clause *> &shrunken);
+  int try_to_subsume_clause (Clause *, vector<Clause *> &shrunken,
+                             const unsigned *tails = 0);
+  int subsume_or_strengthen_clause (Clause *, Clause *, int flipped,
+                                    vector<Clause *> &shrunken);
+  void subsume_connect_clause (Clause *);
   void reset_subsume_bits ();
   bool subsume_round ();
   void subsume ();
@@ -1250,6 +1304,11 @@ struct Internal {
   void elim_propagate (Eliminator &, int unit);
   void elim_on_the_fly_self_subsumption (Eliminator &, Clause *, int);
   void try_to_eliminate_variable (Eliminator &, int pivot, bool &);
+  void elim_check_resolvents (ElimCheck &, vector<signed char> &marks);
+  void elim_check_candidates (Eliminator &, int idx);
+  bool elim_valid_check (Eliminator &, const ElimCheck &);
+  const ElimCheck *elim_find_check (Eliminator &, int idx);
+  void elim_prepare_candidate (Eliminator &, int idx);
   void increase_elimination_bound ();
   int elim_round (bool &completed, bool &);
   void elim (bool update_limits = true);
@@ -1269,18 +1328,20 @@ struct Internal {
   void release_sweeper (Sweeper &sweeper);
   void clear_sweeper (Sweeper &sweeper);
   int sweep_repr (Sweeper &sweeper, int lit);
-  void add_literal_to_environment (Sweeper &sweeper, unsigned depth, int);
+  void add_literal_to_environment (SweepEnvironment &, unsigned depth, int);
   void sweep_clause (Sweeper &sweeper, unsigned depth, Clause *);
-  void sweep_add_clause (Sweeper &sweeper, unsigned depth);
+  void sweep_add_clause (SweepEnvironment &, unsigned depth, unsigned id);
+  bool sweep_environment (SweepEnvironment &, int start, unsigned &depth,
+                         uint64_t &ticks);
   void add_core (Sweeper &sweeper, unsigned core_idx);
   void save_core (Sweeper &sweeper, unsigned core);
   void clear_core (Sweeper &sweeper, unsigned core_idx);
   void save_add_clear_core (Sweeper &sweeper);
-  void init_backbone_and_partition (Sweeper &sweeper);
+  void init_backbone_and_partition (SweepEnvironment &);
   void sweep_empty_clause (Sweeper &sweeper);
-  void sweep_refine_partition (Sweeper &sweeper);
-  void sweep_refine_backbone (Sweeper &sweeper);
-  void sweep_refine (Sweeper &sweeper);
+  void sweep_refine_partition (SweepEnvironment &);
+  void sweep_refine_backbone (SweepEnvironment &);
+  void sweep_refine (SweepEnvironment &);
   void flip_backbone_literals (struct Sweeper &sweeper);
   bool sweep_backbone_candidate (Sweeper &sweeper, int lit);
   int64_t add_sweep_binary (sweep_proof_clause, int lit, int other);
@@ -1606,6 +1667,34 @@ struct Internal {
     vals[-lit] = -val;
   }
 
+  // Search for a non-false replacement watch in '[k,end)' as needed in the
+  // various propagation loops.  If one is found it is returned with its
+  // literal in 'r' and its value in 'v'.  Otherwise 'end' is returned and
+  // 'v' is left negative (the caller has to initialize it to a negative
+  // value).  Most of the time the search stops early, but in long clauses
+  // with many false literals the branch per literal dominates.  Thus the
+  // values of four literals are fetched at once and combined with a
+  // bit-wise 'and', which is negative only if all four are false.  This
+  // also allows the processor to issue these independent memory accesses
+  // to 'vals' in parallel.  The last loop then locates the replacement.
+  //
+  literal_iterator search_replacement (literal_iterator k,
+                                       const_literal_iterator end, int &r,
+                                       signed char &v) const {
+    while (end - k >= 4) {
+      const signed char v0 = val (k[0]);
+      const signed char v1 = val (k[1]);
+      const signed char v2 = val (k[2]);
+      const signed char v3 = val (k[3]);
+      if ((v0 & v1 & v2 & v3) >= 0)
+        break;
+      k += 4;
+    }
+    while (k != end && (v = val (r = *k)) < 0)
+      k++;
+    return k;
+  }
+
   // As 'val' but restricted to the root-level value of a literal.
   // It is not that time critical and also needs to check the decision level
   // of the variable anyhow.
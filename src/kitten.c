@@ -622,6 +622,16 @@ void kitten_track_antecedents (kitten *kitten) {
   kitten->antecedents = true;
 }
 
+// By default the generator is seeded by the number of 'kitten_clear'
+// calls.  Setting it explicitly makes random decisions independent of the
+// instances solved before.
+
+void kitten_seed (kitten *kitten, uint64_t seed) {
+  REQUIRE_INITIALIZED ();
+  LOG ("seeding random number generator with %" PRIu64, seed);
+  kitten->generator = seed;
+}
+
 void kitten_randomize_phases (kitten *kitten) {
   REQUIRE_INITIALIZED ();
 
@@ -25,6 +25,7 @@ void kitten_track_antecedents (kitten *);
 void kitten_shuffle_clauses (kitten *);
 void kitten_flip_phases (kitten *);
 void kitten_randomize_phases (kitten *);
+void kitten_seed (kitten *, uint64_t);
 
 void kitten_assume (kitten *, unsigned lit);
 void kitten_assume_signed (kitten *, int lit);
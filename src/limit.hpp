@@ -23,6 +23,7 @@ struct Limit {
   int64_t elim;              // conflict limit for next 'elim'
   int64_t flush;             // conflict limit for next 'flush'
   int64_t inprobe;           // conflict limit for next 'inprobe'
+  int64_t progress;          // conflict limit for next progress snapshot
   int64_t reduce;            // conflict limit for next 'reduce'
   int64_t rephase;           // conflict limit for next 'rephase'
   int64_t report;            // report limit for header
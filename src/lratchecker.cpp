@@ -1,7 +1,13 @@
 #include "internal.hpp"
 
+#include <atomic>
+
 namespace CaDiCaL {
 
+// Number of derived clauses checked together with 'checkproofthreads'.
+
+static const size_t lrat_checker_batch = 1 << 12;
+
 /*------------------------------------------------------------------------*/
 
 inline unsigned LratChecker::l2u (int lit) {
@@ -38,6 +44,7 @@ LratCheckerClause *LratChecker::new_clause () {
   res->next = 0;
   res->hash = last_hash;
   res->id = last_id;
+  res->deleted = 0;
   res->size = size;
   res->used = false;
   res->tautological = false;
@@ -116,7 +123,8 @@ void LratChecker::collect_garbage_clauses () {
 LratChecker::LratChecker (Internal *i)
     : internal (i), size_vars (0), concluded (false), num_clauses (0),
       num_finalized (0), num_garbage (0), size_clauses (0), clauses (0),
-      garbage (0), last_hash (0), last_id (0), current_id (0) {
+      garbage (0), last_hash (0), last_id (0), current_id (0),
+      num_jobs (0), steps (0) {
 
   // Initialize random number table for hash function.
   //
@@ -139,6 +147,8 @@ void LratChecker::connect_internal (Internal *i) {
 
 LratChecker::~LratChecker () {
   LOG ("LRAT CHECKER delete");
+  if (num_jobs)
+    check_jobs ();
   for (size_t i = 0; i < size_clauses; i++)
     for (LratCheckerClause *c = clauses[i], *next; c; c = next)
       next = c->next, delete_clause (c);
@@ -445,10 +455,201 @@ bool LratChecker::check_blocked (vector<int64_t> proof_chain) {
 
 /*------------------------------------------------------------------------*/
 
+// Remove from hash table, mark as garbage, connect to garbage list.
+
+void LratChecker::remove_clause (LratCheckerClause **p) {
+  LratCheckerClause *d = *p;
+  num_garbage++;
+  assert (num_clauses);
+  num_clauses--;
+  *p = d->next;
+  d->next = garbage;
+  garbage = d;
+  d->garbage = true;
+
+  // If there are enough garbage clauses collect them.
+  // TODO: probably can just delete clause directly without
+  // specific garbage collection phase.
+  if (num_garbage > 0.5 * max ((size_t) size_clauses, (size_t) size_vars))
+    collect_garbage_clauses ();
+}
+
+void LratChecker::failed_to_check () {
+  fatal_message_start ();
+  fputs ("failed to check derived clause:\n", stderr);
+  for (const auto &lit : imported_clause)
+    fprintf (stderr, "%d ", lit);
+  fputc ('0', stderr);
+  fatal_message_end ();
+}
+
+/*------------------------------------------------------------------------*/
+
+// Thread-safe version of 'find' (without statistics) which only returns
+// clauses which existed when the clause of the job was derived.
+
+const LratCheckerClause *
+LratChecker::lookup (const LratCheckerJob &job, int64_t id) const {
+  if (id <= 0 || id >= job.id)
+    return 0;
+  const uint64_t hash = nonces[id % num_nonces] * (uint64_t) id;
+  const uint64_t h = reduce_hash (hash, size_clauses);
+  for (const LratCheckerClause *c = clauses[h]; c; c = c->next)
+    if (c->hash == hash && c->id == id)
+      return c->deleted && c->deleted < job.step ? 0 : c;
+  return 0;
+}
+
+// Combines 'check' and 'check_resolution' for a job of a batch using the
+// scratch data of the thread.  Instead of the 'used' flags of clauses,
+// which would be shared among threads, duplicated ids are found by sorting
+// the part of the chain used to derive the conflict.  The 'touched'
+// variables avoid resetting all 'checked_lits' for each job.
+
+bool LratChecker::check_job (LratCheckerScratch &scratch,
+                             const LratCheckerJob &job) const {
+  auto &checked = scratch.checked_lits;
+  auto &touched = scratch.touched;
+  auto checked_lit = [&checked] (int lit) -> signed char & {
+    return checked[l2u (lit)];
+  };
+  auto reset = [&] () {
+    for (const auto &idx : touched)
+      checked_lit (idx) = checked_lit (-idx) = false;
+    touched.clear ();
+  };
+  const auto &chain = job.chain;
+  assert (!chain.empty () && chain.back () > 0);
+
+  bool taut = false;
+  for (const auto &lit : job.clause) {
+    touched.push_back (abs (lit));
+    checked_lit (-lit) = true;
+    if (checked_lit (lit))
+      taut = true;
+  }
+  bool checking = taut;
+  if (!taut) {
+    size_t k = 0;
+    for (; k < chain.size (); k++) {
+      const LratCheckerClause *c = lookup (job, chain[k]);
+      if (!c || c->tautological)
+        break;
+      int unit = 0;
+      for (const int *i = c->literals; i < c->literals + c->size; i++) {
+        const int lit = *i;
+        if (checked_lit (-lit))
+          continue;
+        if (unit && unit != lit) {
+          unit = INT_MIN;
+          break;
+        }
+        unit = lit;
+      }
+      if (unit == INT_MIN)
+        break;
+      if (!unit) {
+        checking = true;
+        break;
+      }
+      touched.push_back (abs (unit));
+      checked_lit (unit) = true;
+    }
+    if (checking) {
+      auto &prefix = scratch.prefix;
+      prefix.assign (chain.begin (), chain.begin () + k + 1);
+      sort (prefix.begin (), prefix.end ());
+      if (std::adjacent_find (prefix.begin (), prefix.end ()) !=
+          prefix.end ())
+        checking = false;
+    }
+  }
+  reset ();
+  if (!checking)
+    return false;
+
+  const LratCheckerClause *c = lookup (job, chain.back ());
+  if (!c)
+    return false;
+  for (const int *i = c->literals; i < c->literals + c->size; i++) {
+    const int lit = *i;
+    touched.push_back (abs (lit));
+    checked_lit (lit) = true;
+  }
+  for (auto p = chain.end () - 2; p >= chain.begin (); p--) {
+    c = lookup (job, *p);
+    if (!c) {
+      reset ();
+      return false;
+    }
+    for (const int *i = c->literals; i < c->literals + c->size; i++) {
+      const int lit = *i;
+      touched.push_back (abs (lit));
+      if (!checked_lit (-lit))
+        checked_lit (lit) = true;
+      else
+        checked_lit (-lit) = false;
+    }
+  }
+  for (const auto &lit : job.clause) {
+    if (checked_lit (-lit)) {
+      reset ();
+      return false;
+    }
+    touched.push_back (abs (lit));
+    checked_lit (lit) = checked_lit (-lit) = true;
+  }
+  bool failed = false;
+  for (const auto &idx : touched)
+    if (checked_lit (idx) != checked_lit (-idx))
+      failed = true;
+  reset ();
+  return !failed;
+}
+
+// Check all jobs of the current batch in parallel, then report the first
+// failed job (after trying 'check_blocked' sequentially) and finally
+// remove the clauses of deferred deletions.
+
+void LratChecker::check_jobs () {
+  const size_t threads = std::min (
+      (size_t) std::max (1, internal->opts.checkproofthreads), num_jobs);
+  while (scratches.size () < threads)
+    scratches.push_back (LratCheckerScratch ());
+  for (size_t i = 0; i < threads; i++)
+    scratches[i].checked_lits.resize (checked_lits.size ());
+  std::atomic<size_t> next (0);
+  internal->pool.run (threads, [&] (size_t worker) {
+    size_t i;
+    while ((i = next++) < num_jobs)
+      jobs[i].failed = !check_job (scratches[worker], jobs[i]);
+  });
+  for (size_t i = 0; i < num_jobs; i++) {
+    LratCheckerJob &job = jobs[i];
+    if (!job.failed)
+      continue;
+    imported_clause = job.clause;
+    if (!check_blocked (job.chain))
+      failed_to_check ();
+    imported_clause.clear ();
+  }
+  num_jobs = 0;
+  for (const auto &id : deferred) {
+    LratCheckerClause **p = find (id);
+    assert (*p), assert ((*p)->deleted);
+    remove_clause (p);
+  }
+  deferred.clear ();
+}
+
+/*------------------------------------------------------------------------*/
+
 void LratChecker::add_original_clause (int64_t id, bool,
                                        const vector<int> &c, bool restore) {
   START (checking);
   LOG (c, "LRAT CHECKER addition of original clause[%" PRId64 "]", id);
+  if (num_jobs)
+    check_jobs ();
   if (restore)
     restore_clause (id, c);
   stats.added++;
@@ -500,6 +701,26 @@ void LratChecker::add_derived_clause (int64_t id, bool, int w,
     }
   }
   assert (id);
+  if (internal->opts.checkproofthreads && !proof_chain.empty () &&
+      proof_chain.back () > 0) {
+    stats.checks++;
+    insert ();
+    if (num_jobs == jobs.size ())
+      jobs.push_back (LratCheckerJob ());
+    LratCheckerJob &job = jobs[num_jobs++];
+    job.id = id;
+    job.step = ++steps;
+    job.clause = imported_clause;
+    job.chain = proof_chain;
+    job.failed = false;
+    imported_clause.clear ();
+    if (num_jobs == lrat_checker_batch)
+      check_jobs ();
+    STOP (checking);
+    return;
+  }
+  if (num_jobs)
+    check_jobs ();
   bool failed = true;
   if (check (proof_chain) && check_resolution (proof_chain)) {
     failed = false;
@@ -515,12 +736,7 @@ void LratChecker::add_derived_clause (int64_t id, bool, int w,
       LOG (d->literals, d->size, "clause[%" PRId64 "]", pid);
     }
 #endif
-    fatal_message_start ();
-    fputs ("failed to check derived clause:\n", stderr);
-    for (const auto &lit : imported_clause)
-      fprintf (stderr, "%d ", lit);
-    fputc ('0', stderr);
-    fatal_message_end ();
+    failed_to_check ();
   } else
     insert ();
   imported_clause.clear ();
@@ -568,6 +784,8 @@ void LratChecker::reset_assumptions () {
 
 void LratChecker::conclude_unsat (ConclusionType conclusion,
                                   const vector<int64_t> &ids) {
+  if (num_jobs)
+    check_jobs ();
   if (concluded) {
     fatal_message_start ();
     fputs ("already concluded\n", stderr);
@@ -630,7 +848,7 @@ void LratChecker::delete_clause (int64_t id, bool, const vector<int> &c) {
   import_clause (c);
   last_id = id;
   LratCheckerClause **p = find (id), *d = *p;
-  if (d) {
+  if (d && !d->deleted) {
     for (const auto &lit : imported_clause)
       mark (lit) = true;
     const int *dp = d->literals;
@@ -648,20 +866,13 @@ void LratChecker::delete_clause (int64_t id, bool, const vector<int> &c) {
     for (const auto &lit : imported_clause)
       mark (lit) = false;
 
-    // Remove from hash table, mark as garbage, connect to garbage list.
-    num_garbage++;
-    assert (num_clauses);
-    num_clauses--;
-    *p = d->next;
-    d->next = garbage;
-    garbage = d;
-    d->garbage = true;
-
-    // If there are enough garbage clauses collect them.
-    // TODO: probably can just delete clause directly without
-    // specific garbage collection phase.
-    if (num_garbage > 0.5 * max ((size_t) size_clauses, (size_t) size_vars))
-      collect_garbage_clauses ();
+    // Pending checks in the current batch might still use the clause.
+    //
+    if (num_jobs) {
+      d->deleted = ++steps;
+      deferred.push_back (id);
+    } else
+      remove_clause (p);
   } else {
     fatal_message_start ();
     fputs ("deleted clause not in proof:\n", stderr);
@@ -678,6 +889,8 @@ void LratChecker::delete_clause (int64_t id, bool, const vector<int> &c) {
 
 void LratChecker::weaken_minus (int64_t id, const vector<int> &c) {
   LOG (c, "LRAT CHECKER saving clause[%" PRId64 "] to restore later", id);
+  if (num_jobs)
+    check_jobs ();
   import_clause (c);
 
   assert (id <= current_id);
@@ -757,6 +970,8 @@ void LratChecker::restore_clause (int64_t id, const vector<int> &c) {
 void LratChecker::finalize_clause (int64_t id, const vector<int> &c) {
   START (checking);
   LOG (c, "LRAT CHECKER checking finalize of clause[%" PRId64 "]", id);
+  if (num_jobs)
+    check_jobs ();
   stats.finalized++;
   num_finalized++;
   import_clause (c);
@@ -796,6 +1011,8 @@ void LratChecker::finalize_clause (int64_t id, const vector<int> &c) {
 // check if all clauses have been deleted
 void LratChecker::report_status (int, int64_t) {
   START (checking);
+  if (num_jobs)
+    check_jobs ();
   if (num_finalized == num_clauses) {
     num_finalized = 0;
     LOG ("LRAT CHECKER successful finalize check, all clauses have been "
@@ -813,6 +1030,8 @@ void LratChecker::report_status (int, int64_t) {
 /*------------------------------------------------------------------------*/
 
 void LratChecker::dump () {
+  if (num_jobs)
+    check_jobs ();
   int max_var = 0;
   for (uint64_t i = 0; i < size_clauses; i++)
     for (LratCheckerClause *c = clauses[i]; c; c = c->next)
@@ -22,6 +22,7 @@ struct LratCheckerClause {
   LratCheckerClause *next; // collision chain link for hash table
   uint64_t hash;           // previously computed full 64-bit hash
   int64_t id;              // id of clause
+  uint64_t deleted;        // step of deferred deletion (if non-zero)
   bool garbage;            // for garbage clauses
   unsigned size;
   bool used;
@@ -29,6 +30,27 @@ struct LratCheckerClause {
   int literals[1]; // 'literals' of length 'size'
 };
 
+// With 'checkproofthreads' derived clauses are inserted right away but
+// their proof chains are only checked in batches by several threads (see
+// 'check_jobs').  During such a batch check the clause table is not
+// modified.  Deletions are deferred to the end of the batch and the step
+// of a job (and of a deletion) is used to make sure that only clauses
+// added before and not deleted before the job are used in its check.
+
+struct LratCheckerJob {
+  int64_t id;    // id of derived clause
+  uint64_t step; // to compare with 'deleted' steps
+  std::vector<int> clause;
+  std::vector<int64_t> chain;
+  bool failed;
+};
+
+struct LratCheckerScratch {
+  std::vector<signed char> checked_lits;
+  std::vector<int> touched; // variables to reset in 'checked_lits'
+  std::vector<int64_t> prefix;
+};
+
 /*------------------------------------------------------------------------*/
 
 class LratChecker : public StatTracer {
@@ -96,6 +118,20 @@ class LratChecker : public StatTracer {
   bool check_resolution (std::vector<int64_t>); // check resolution
   bool check_blocked (std::vector<int64_t>);    // check ER
 
+  // Batched checking by multiple threads.
+  //
+  std::vector<LratCheckerJob> jobs;
+  size_t num_jobs;
+  uint64_t steps;                // counts jobs and deferred deletions
+  std::vector<int64_t> deferred; // deleted at the end of the batch
+  std::vector<LratCheckerScratch> scratches;
+
+  const LratCheckerClause *lookup (const LratCheckerJob &, int64_t) const;
+  bool check_job (LratCheckerScratch &, const LratCheckerJob &) const;
+  void check_jobs ();
+  void remove_clause (LratCheckerClause **);
+  void failed_to_check ();
+
   struct {
 
     int64_t added;    // number of added clauses
@@ -34,6 +34,8 @@ bool Internal::minimize_literal (int lit, int depth) {
   assert (v.reason);
   if (opts.minimizeticks)
     stats.ticks.search[stable]++;
+  if (opts.cprofile)
+    cprofile.current.minimize++;
   if (v.reason == external_reason) {
     assert (!opts.exteagerreasons);
     v.reason = learn_external_reason_clause (lit, 0, true);
@@ -221,4 +223,83 @@ void Internal::clear_minimized_literals () {
   minimized.clear ();
 }
 
+/*------------------------------------------------------------------------*/
+
+// Binary implication minimization as in Glucose.  If there is a binary
+// clause '(lit | other)' with the asserting literal 'lit' of the learned
+// clause, and '-other' also occurs in the learned clause, then '-other' is
+// removed by resolving with that binary clause.  Recursive minimization
+// misses these literals if 'other' was not assigned through this binary
+// clause.  Only the binary watches of the asserting literal are checked
+// against the (marked) literals in the clause and we stop after visiting
+// 'minimizebinticks' watches.  For LRAT the binary clauses become the
+// first antecedents, since they only depend on the asserting literal
+// ('lrat_chain' is still reversed at this point).  Unlike
+// 'minimize_literal' this might remove the last literal of a level and
+// thus the 'glue' is recomputed if literals were removed (as Glucose
+// computes the LBD after binary minimization too).
+
+void Internal::minimize_clause_with_binaries (int lit, int &glue) {
+  assert (opts.minimizebin);
+  assert (val (lit) < 0);
+  if ((int) clause.size () > opts.minimizebinsize)
+    return;
+  START (minimize);
+  for (const auto &other : clause)
+    if (other != lit)
+      mark (other);
+  const Watches &ws = watches (lit);
+  const int64_t limit = opts.minimizebinticks;
+  int64_t ticks = 0;
+  size_t removed = 0;
+  for (const auto &w : ws) {
+    if (++ticks > limit)
+      break;
+    if (!w.binary ())
+      continue;
+    const int other = -w.blit;
+    if (marked (other) <= 0)
+      continue;
+    assert (val (other) < 0);
+    LOG (w.clause, "removing %d through", other);
+    unmark (other);
+    if (lrat)
+      lrat_chain.push_back (w.clause->id);
+    removed++;
+  }
+  const auto end = clause.end ();
+  auto j = clause.begin ();
+  for (auto i = j; i != end; i++) {
+    const int other = *i;
+    if (other != lit) {
+      if (marked (other) <= 0)
+        continue;
+      unmark (other);
+    }
+    *j++ = other;
+  }
+  assert ((size_t) (end - j) == removed);
+  clause.resize (j - clause.begin ());
+  LOG (clause, "removed %zd literals through binaries", removed);
+  if (removed) {
+    vector<int> clause_levels;
+    for (const auto &other : clause)
+      clause_levels.push_back (var (other).level);
+    sort (clause_levels.begin (), clause_levels.end ());
+    const auto levels_end =
+        unique (clause_levels.begin (), clause_levels.end ());
+    const int new_glue = (levels_end - clause_levels.begin ()) - 1;
+    assert (new_glue <= glue);
+    if (new_glue < glue)
+      LOG ("binary minimization reduced glue from %d to %d", glue,
+           new_glue);
+    glue = new_glue;
+  }
+  stats.binminimized += removed;
+  stats.ticks.search[stable] += ticks;
+  if (opts.cprofile)
+    cprofile.current.minimize += ticks;
+  STOP (minimize);
+}
+
 } // namespace CaDiCaL
@@ -13,7 +13,7 @@ using namespace std;
 
 typedef vector<Clause *> Occs;
 
-inline void shrink_occs (Occs &os) { shrink_vector (os); }
+inline void shrink_occs (Occs &os) { shrink_sparse_vector (os); }
 inline void erase_occs (Occs &os) { erase_vector (os); }
 
 inline void remove_occs (Occs &os, Clause *c) {
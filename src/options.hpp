@@ -23,6 +23,7 @@
 \
 OPTION( arena,             1,  0,  1,0,0,1, "allocate clauses in arena") \
 OPTION( arenacompact,      1,  0,  1,0,0,1, "keep clauses compact") \
+OPTION( arenahuge,         0,  0,  1,0,0,1, "huge pages for arena") \
 OPTION( arenasort,         1,  0,  1,0,0,1, "sort clauses in arena") \
 OPTION( arenatype,         3,  1,  3,0,0,1, "1=clause, 2=var, 3=queue") \
 OPTION( backbone,          1,  0,  2,0,0,1, "binary clause backbone") \
@@ -36,6 +37,8 @@ OPTION( blockmaxclslim,  1e5,  1,2e9,2,0,1, "maximum clause size") \
 OPTION( blockminclslim,    2,  2,2e9,0,0,1, "minimum clause size") \
 OPTION( blockocclim,     1e2,  1,2e9,2,0,1, "occurrence limit") \
 OPTION( bump,              1,  0,  1,0,0,1, "bump variables") \
+OPTION( bumpbatch,         1,  0,  1,0,0,1, "bump analyzed variables at once") \
+OPTION( bumpbatchheap,    10,  0,100,0,0,1, "rebuild heap if bumping percent") \
 OPTION( bumpreason,        1,  0,  1,0,0,1, "bump reason literals too") \
 OPTION( bumpreasondepth,   1,  1,  3,0,0,1, "bump reason depth") \
 OPTION( bumpreasonlimit,  10,  1,2e9,0,0,1, "bump reason limit") \
@@ -46,11 +49,13 @@ OPTION( checkconstraint,   1,  0,  1,0,0,0, "check constraint satisfied") \
 OPTION( checkfailed,       1,  0,  1,0,0,0, "check failed literals form core") \
 OPTION( checkfrozen,       0,  0,  1,0,0,0, "check all frozen semantics") \
 OPTION( checkproof,        3,  0,  3,0,0,0, "1=drat, 2=lrat, 3=both") \
+OPTION( checkproofthreads, 0,  0, 64,0,0,0, "threads for batched LRAT checking") \
 OPTION( checkwitness,      1,  0,  1,0,0,0, "check witness internally") \
 OPTION( chrono,            1,  0,  2,0,0,1, "chronological backtracking") \
 OPTION( chronoalways,      0,  0,  1,0,0,1, "force always chronological") \
 OPTION( chronolevelim,   1e2,  0,2e9,0,0,1, "chronological level limit") \
 OPTION( chronoreusetrail,  1,  0,  1,0,0,1, "reuse trail chronologically") \
+OPTION( collectthreads,    0,  0, 64,0,0,1, "threads copying and flushing") \
 OPTION( compact,           1,  0,  1,0,1,1, "compact internal variables") \
 OPTION( compactint,      2e3,  1,2e9,0,0,1, "compacting interval") \
 OPTION( compactlim,      1e2,  0,1e3,0,0,1, "inactive limit per mille") \
@@ -75,6 +80,8 @@ OPTION( covermaxclslim,  1e5,  1,2e9,2,0,1, "maximum clause size") \
 OPTION( covermaxeff,     1e8,  0,2e9,1,0,1, "maximum cover efficiency") \
 OPTION( coverminclslim,    2,  2,2e9,0,0,1, "minimum clause size") \
 OPTION( covermineff,       0,  0,2e9,1,0,1, "minimum cover efficiency") \
+OPTION( cprofile,          0,  0,  1,0,0,0, "profile conflict analysis") \
+OPTION( cprofiletop,      16,  1,1e4,0,0,0, "number of hottest reasons profiled") \
 OPTION( decompose,         1,  0,  1,0,1,1, "decompose BIG in SCCs and ELS") \
 OPTION( decomposerounds,   2,  1, 16,1,0,1, "number of decompose rounds") \
 OPTION( deduplicate,       1,  0,  1,0,1,1, "remove duplicated binaries") \
@@ -102,6 +109,7 @@ OPTION( elimprod,          1,  0,1e4,0,0,1, "elim score product weight") \
 OPTION( elimrounds,        2,  1,512,1,0,1, "usual number of rounds") \
 OPTION( elimsubst,         1,  0,  1,0,0,1, "elimination by substitution") \
 OPTION( elimsum,           1,  0,1e4,0,0,1, "elimination score sum weight") \
+OPTION( elimthreads,       0,  0, 64,0,0,1, "threads counting resolvents") \
 OPTION( elimxorlim,        5,  2, 27,1,0,1, "maximum XOR size") \
 OPTION( elimxors,          1,  0,  1,0,0,1, "find XOR gates") \
 OPTION( emadecisions,    1e5,  1,2e9,0,0,1, "window decision rate") \
@@ -112,6 +120,7 @@ OPTION( emalevel,        1e5,  1,2e9,0,0,1, "window back-track level") \
 OPTION( emasize,         1e5,  1,2e9,0,0,1, "window learned clause size") \
 OPTION( ematrailfast,    1e2,  1,2e9,0,0,1, "window fast trail") \
 OPTION( ematrailslow,    1e5,  1,2e9,0,0,1, "window slow trail") \
+OPTION( exportglue,        0,  0,2e9,0,0,1, "export only clauses up to this glue (0=all)") \
 OPTION( exteagerreasons,   1,  0,  1,0,0,1, "eagerly ask for all reasons (0: only when needed)") \
 OPTION( exteagerrecalc,    1,  0,  1,0,0,1, "after eagerly asking for reasons recalculate all levels (0: trust the external tool)") \
 OPTION( externallrat,      0,  0,  1,0,0,1, "external lrat") \
@@ -154,10 +163,15 @@ OPTION( luckyassumptions,  1,  0,  1,0,0,1, "lucky phases with assumptions") \
 OPTION( luckyearly,        1,  0,  1,0,0,1, "lucky phases before preprocessing") \
 OPTION( luckylate,         1,  0,  1,0,0,1, "lucky phases after preprocessing") \
 OPTION( minimize,          1,  0,  1,0,0,1, "minimize learned clauses") \
+OPTION( minimizebin,       0,  0,  1,0,0,1, "minimize learned clauses with binaries") \
+OPTION( minimizebinsize,  30,  2,2e9,0,0,1, "maximum clause size for binary minimization") \
+OPTION( minimizebinticks,1e3,  1,2e9,0,0,1, "maximum watches visited in binary minimization") \
 OPTION( minimizedepth,   1e3,  0,1e3,0,0,1, "minimization depth") \
 OPTION( minimizeticks,     1,  0,  1,0,0,1, "increment ticks in minimization") \
 OPTION( otfs,              1,  0,  1,0,0,1, "on-the-fly self subsumption") \
 OPTION( phase,             1,  0,  1,0,0,1, "initial phase") \
+OPTION( prefetch,          0,  0, 16,0,0,1, "prefetch distance in propagation") \
+OPTION( prefetchvars,    1e5,  0,2e9,0,0,1, "prefetch in analyze above this many variables") \
 OPTION( preprocessinit,  2e6,  0,2e9,2,0,1, "initial preprocessing base limit" ) \
 OPTION( preprocesslight,   1,  0,  1,0,1,1, "lightweight preprocessing" ) \
 OPTION( probe,             1,  0,  1,0,1,1, "failed literal probing" ) \
@@ -165,6 +179,7 @@ OPTION( probeeffort,       8,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( probehbr,          1,  0,  1,0,0,1, "learn hyper binary clauses") \
 OPTION( probethresh,       0,  0,100,1,0,1, "delay if ticks smaller thresh*clauses") \
 OPTION( profile,           2,  0,  4,0,0,0, "profiling level") \
+OPTION( progressint,     1e3,  1,2e9,0,0,0, "progress snapshot interval") \
 QUTOPT( quiet,             0,  0,  1,0,0,0, "disable all messages") \
 OPTION( radixsortlim,     32,  0,2e9,0,0,1, "radix sort limit") \
 OPTION( randec,            0,  0,  1,0,0,1, "random decisions") \
@@ -178,6 +193,7 @@ OPTION( recomputetier,     1,  0,  1,0,0,1, "recompute tiers") \
 OPTION( reduce,            1,  0,  1,0,0,1, "reduce useless clauses") \
 OPTION( reduceinit,      300,  1,1e6,0,0,1, "initial interval") \
 OPTION( reduceint,        25,  2,1e6,0,0,1, "reduce interval") \
+OPTION( reducelazy,        0,  0,100,0,0,1, "collect if percent garbage (0=always)") \
 OPTION( reduceopt,         1,  0,  2,0,0,1, "0=prct,1=sqrt,2=max") \
 OPTION( reducetarget,     75, 10,1e2,0,0,1, "reduce fraction in percent") \
 OPTION( reducetier1glue,   2,  1,2e9,0,0,1, "glue of kept learned clauses") \
@@ -199,6 +215,7 @@ OPTION( restoreall,        0,  0,  2,0,0,1, "restore all clauses (2=really)") \
 OPTION( restoreflush,      0,  0,  1,0,0,1, "remove satisfied clauses") \
 OPTION( reverse,           0,  0,  1,0,0,1, "reverse variable ordering") \
 OPTION( score,             1,  0,  1,0,0,1, "use EVSIDS scores") \
+OPTION( scorearity,        1,  1,  4,0,0,1, "log2 of score heap arity") \
 OPTION( scorefactor,     950,500,1e3,0,0,1, "score factor per mille") \
 OPTION( seed,              0,  0,2e9,0,0,1, "random seed") \
 OPTION( shrink,            3,  0,  3,0,0,1, "shrink conflict clause (1=binary-only,2=minimize-on-pulling,3=full)") \
@@ -221,6 +238,7 @@ OPTION( subsumemaxeff,   1e8,  0,2e9,1,0,1, "maximum subsuming efficiency") \
 OPTION( subsumemineff,     0,  0,2e9,1,0,1, "minimum subsuming efficiency") \
 OPTION( subsumeocclim,   1e2,  0,2e9,1,0,1, "watch list length limit") \
 OPTION( subsumestr,        1,  0,  1,0,0,1, "subsume strengthen") \
+OPTION( subsumethreads,    0,  0, 64,0,0,1, "threads for forward checks") \
 OPTION( sweep,             1,  0,  1,0,1,1, "enable SAT sweeping") \
 OPTION( sweepclauses,   1024,  0,2e9,1,0,1, "environment clauses") \
 OPTION( sweepcomplete,     0,  0,  1,0,0,1, "run SAT sweeping to completion") \
@@ -232,6 +250,7 @@ OPTION( sweepmaxclauses, 3e5,  2,2e9,1,0,1, "maximum environment clauses") \
 OPTION( sweepmaxdepth,     3,  1,2e9,1,0,1, "maximum environment depth") \
 OPTION( sweepmaxvars,   8192,  2,2e9,1,0,1, "maximum environment variables") \
 OPTION( sweeprand,         0,  0,  1,0,0,1, "randomize sweeping environment") \
+OPTION( sweepthreads,      0,  0, 64,0,0,1, "threads for speculative sweeping") \
 OPTION( sweepthresh,       5,  0,100,1,0,1, "delay if ticks smaller thresh*clauses") \
 OPTION( sweepvars,       256,  0,2e9,1,0,1, "environment variables") \
 OPTION( target,            1,  0,  2,0,0,1, "target phases (1=stable only)") \
@@ -246,6 +265,7 @@ OPTION( tier1limit,       50,  0,100,0,0,1, "limit of tier1 usage in percentage"
 OPTION( tier1minglue,      0,  0,100,0,0,1, "lowest tier1 limit") \
 OPTION( tier2limit,       90,  0,100,0,0,1, "limit of tier2 usage in percentage") \
 OPTION( tier2minglue,      0,  0,100,0,0,1, "lowest tier2 limit") \
+OPTION( trailsave,         0,  0,  1,0,0,1, "save and replay trail after back-jumps") \
 OPTION( transred,          1,  0,  1,0,1,1, "transitive reduction of BIG") \
 OPTION( transredeffort,  1e2,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( transredmaxeff,  1e8,  0,2e9,1,0,1, "maximum efficiency") \
@@ -263,6 +283,7 @@ OPTION( vivifyirredeff,    3,  1,100,1,0,1, "irredundant efficiency per mille")
 OPTION( vivifyonce,        0,  0,  2,0,0,1, "vivify once: 1=red, 2=red+irr") \
 OPTION( vivifyretry,       0,  0,  5,0,0,1, "re-vivify clause if vivify was successful") \
 OPTION( vivifyschedmax,  5e3, 10,2e9,0,0,1, "maximum schedule size") \
+OPTION( vivifythreads,     0,  0, 64,0,0,1, "threads checking candidates") \
 OPTION( vivifythresh,     20,  0,100,1,0,1, "delay if ticks smaller thresh*clauses") \
 OPTION( vivifytier1,       1,  0,  1,0,0,1, "vivification tier1") \
 OPTION( vivifytier1eff,    4,  0,100,1,0,1, "relative tier1 effort") \
@@ -0,0 +1,70 @@
+#include "pool.hpp"
+
+#include <cassert>
+
+namespace CaDiCaL {
+
+ThreadPool::ThreadPool ()
+    : work (0), workers (0), running (0), batches (0), stopping (false) {}
+
+ThreadPool::~ThreadPool () {
+  {
+    std::lock_guard<std::mutex> guard (lock);
+    stopping = true;
+  }
+  started.notify_all ();
+  for (auto &helper : helpers)
+    helper.join ();
+}
+
+// Helpers wait for the next batch.  If a helper is not needed for a batch
+// it just waits for the next one.  Since 'run' waits for all participating
+// helpers a helper can not miss a batch it is needed for.
+
+void ThreadPool::help (size_t worker) {
+  assert (worker);
+  uint64_t seen = 0;
+  std::unique_lock<std::mutex> guard (lock);
+  for (;;) {
+    started.wait (guard, [&] { return stopping || batches != seen; });
+    if (stopping)
+      return;
+    seen = batches;
+    if (worker >= workers)
+      continue;
+    const std::function<void (size_t)> &batch = *work;
+    guard.unlock ();
+    batch (worker);
+    guard.lock ();
+    assert (running);
+    if (!--running)
+      finished.notify_one ();
+  }
+}
+
+void ThreadPool::run (size_t new_workers,
+                      const std::function<void (size_t)> &new_work) {
+  if (new_workers <= 1) {
+    if (new_workers)
+      new_work (0);
+    return;
+  }
+  std::unique_lock<std::mutex> guard (lock);
+  assert (!work);
+  while (helpers.size () + 1 < new_workers)
+    helpers.push_back (
+        std::thread (&ThreadPool::help, this, helpers.size () + 1));
+  work = &new_work;
+  workers = new_workers;
+  running = new_workers - 1;
+  batches++;
+  guard.unlock ();
+  started.notify_all ();
+  new_work (0);
+  guard.lock ();
+  finished.wait (guard, [&] { return !running; });
+  work = 0;
+  workers = 0;
+}
+
+} // namespace CaDiCaL
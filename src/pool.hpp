@@ -0,0 +1,51 @@
+#ifndef _pool_hpp_INCLUDED
+#define _pool_hpp_INCLUDED
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CaDiCaL {
+
+// Persistent helper threads for the optional parallel parts of garbage
+// collection ('collectthreads'), inprocessing ('elimthreads',
+// 'subsumethreads', 'sweepthreads' and 'vivifythreads') and of the LRAT
+// checker ('checkproofthreads').  These run many small batches of work
+// (for instance elimination checks only cover a few candidates) and
+// starting new threads for every batch would cost more than the batch
+// itself.  Helper threads are only started on demand by the first 'run'
+// which needs them and then wait for the next batch until the pool is
+// destroyed together with 'Internal'.
+
+class ThreadPool {
+
+  std::mutex lock;
+  std::condition_variable started, finished;
+  std::vector<std::thread> helpers;
+
+  const std::function<void (size_t)> *work; // of the current batch
+  size_t workers;                           // of the current batch
+  size_t running;                           // helpers still working
+  uint64_t batches;                         // started so far
+  bool stopping;
+
+  void help (size_t worker);
+
+public:
+  ThreadPool ();
+  ~ThreadPool ();
+
+  // Calls 'work (worker)' for every 'worker' in '[0, workers)' in parallel
+  // and returns after all of them finished.  Worker zero is the calling
+  // thread.  The function is not reentrant.
+  //
+  void run (size_t workers, const std::function<void (size_t)> &work);
+};
+
+} // namespace CaDiCaL
+
+#endif
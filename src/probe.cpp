@@ -448,13 +448,11 @@ bool Internal::probe_propagate () {
           literal_iterator k = middle;
           int r = 0;
           signed char v = -1;
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
+          k = search_replacement (k, end, r, v);
           if (v < 0) {
             k = lits + 2;
             assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
+            k = search_replacement (k, middle, r, v);
           }
           w.clause->pos = k - lits;
           assert (lits + 2 <= k), assert (k <= w.clause->end ());
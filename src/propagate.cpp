@@ -206,6 +206,57 @@ void Internal::search_assign_external (int lit) {
 
 /*------------------------------------------------------------------------*/
 
+// Replay the literals saved in 'save_trail' (see 'backtrack.cpp') after
+// the saved literal before 'position' was just propagated.  Replaying
+// stops at the next saved decision, at a saved literal which is false now
+// (its reason is then a conflict) or at the first saved reason which is
+// not a reason (yet), i.e., if one of its other literals is not false.
+// The saved trail is kept, since propagating another saved literal later
+// might continue replaying from there.  Checking a reason costs as much as
+// visiting the clause in 'propagate' and thus is accounted as a tick.
+
+void Internal::replay_saved_trail (size_t position, int64_t &ticks) {
+  assert (position && position <= saved_trail.size ());
+  assert (val (saved_trail[position - 1]) > 0);
+  assert (!conflict);
+  while (position < saved_trail.size ()) {
+    const int lit = saved_trail[position];
+    Clause *reason = saved_reasons[position];
+    if (!reason)
+      break; // Wait until this decision is propagated again.
+    if (reason->garbage)
+      break;
+    position++;
+    const signed char tmp = val (lit);
+    if (tmp > 0)
+      continue;
+    ticks++;
+    bool valid = false;
+    for (const auto &other : *reason)
+      if (other == lit)
+        valid = true;
+      else if (val (other) >= 0) {
+        valid = false;
+        break;
+      }
+    if (!valid) {
+      LOG (reason, "saved reason of %d not a reason", lit);
+      break;
+    }
+    if (tmp < 0) {
+      LOG (reason, "saved reason of %d conflicting", lit);
+      stats.trailsave.conflicts++;
+      conflict = reason;
+      break;
+    }
+    build_chain_for_units (lit, reason, 0);
+    search_assign (lit, reason);
+    stats.trailsave.replayed++;
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 // The 'propagate' function is usually the hot-spot of a CDCL SAT solver.
 // The 'trail' stack saves assigned variables and is used here as BFS queue
 // for checking clauses with the negation of assigned variables for being in
@@ -237,20 +288,79 @@ bool Internal::propagate () {
   int64_t before = propagated;
   int64_t ticks = 0;
 
+  // Optional software prefetching pipeline (disabled by default). While
+  // propagating the trail literal at position 'propagated' the watch lists
+  // of the next 'prefetch' literals on the trail are prefetched.  Within a
+  // watch list the clause of the watch 'prefetch' positions ahead is
+  // prefetched if it is a large clause and its blocking literal is not
+  // true, i.e., if the clause is likely to be visited.
+  //
+  const int prefetch = opts.prefetch;
+  size_t prefetched = propagated;
+  int64_t prefetched_watches = 0, prefetched_clauses = 0;
+
   while (!conflict && propagated != trail.size ()) {
 
     const int lit = -trail[propagated++];
     LOG ("propagating %d", -lit);
     Watches &ws = watches (lit);
 
+    if (prefetch) {
+      if (prefetched < propagated)
+        prefetched = propagated;
+      const size_t limit = min (trail.size (), propagated + prefetch);
+      while (prefetched < limit) {
+        const Watches &pws = watches (-trail[prefetched++]);
+        if (pws.empty ())
+          continue;
+        __builtin_prefetch (pws.data (), 0, 1);
+        prefetched_watches++;
+      }
+    }
+
     const const_watch_iterator eow = ws.end ();
     watch_iterator j = ws.begin ();
+    ticks += 1 + cache_lines (ws.size (), sizeof *j);
+
+    // Binary watches are put in front of the large clause watches during
+    // 'connect_watches' and by 'flush_watches' during garbage collection.
+    // This binary prefix is walked first in a tight loop which only needs
+    // the values of the blocking literals and never drops a watch.  Binary
+    // watches added since the last garbage collection are appended at the
+    // end and thus are still handled by the general loop below.
+
+    while (j != eow && j->binary ()) {
+
+      const Watch w = *j++;
+      const signed char b = val (w.blit);
+      LOG (w.clause, "checking");
+
+      if (b > 0)
+        continue;
+
+      if (b < 0)
+        conflict = w.clause; // but continue ...
+      else {
+        build_chain_for_units (w.blit, w.clause, 0);
+        search_assign (w.blit, w.clause);
+        ticks++;
+      }
+    }
+
     const_watch_iterator i = j;
-    ticks += 1 + cache_lines (ws.size (), sizeof *i);
 
     while (i != eow) {
 
       const Watch w = *j++ = *i++;
+
+      if (prefetch && eow - i >= prefetch) {
+        const Watch &p = i[prefetch - 1];
+        if (!p.binary () && val (p.blit) <= 0) {
+          __builtin_prefetch (p.clause, 0, 1);
+          prefetched_clauses++;
+        }
+      }
+
       const signed char b = val (w.blit);
       LOG (w.clause, "checking");
 
@@ -351,15 +461,13 @@ bool Internal::propagate () {
           int r = 0;
           signed char v = -1;
 
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
+          k = search_replacement (k, end, r, v);
 
           if (v < 0) { // need second search starting at the head?
 
             k = lits + 2;
             assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
+            k = search_replacement (k, middle, r, v);
           }
 
           w.clause->pos = k - lits; // always save position
@@ -458,6 +566,12 @@ bool Internal::propagate () {
 
       ws.resize (j - ws.begin ());
     }
+
+    if (!saved_trail.empty () && !conflict) {
+      const unsigned position = saved_positions[vidx (lit)];
+      if (position && saved_trail[position - 1] == -lit)
+        replay_saved_trail (position, ticks);
+    }
   }
 
   if (searching_lucky_phases) {
@@ -471,6 +585,8 @@ bool Internal::propagate () {
     //
     stats.propagations.search += propagated - before;
     stats.ticks.search[stable] += ticks;
+    stats.prefetched.watches += prefetched_watches;
+    stats.prefetched.clauses += prefetched_clauses;
 
     if (!conflict)
       no_conflict_until = propagated;
@@ -545,14 +661,12 @@ void Internal::propergate () {
       int r = 0;
       signed char v = -1;
 
-      while (k != end && (v = val (r = *k)) < 0)
-        k++;
+      k = search_replacement (k, end, r, v);
 
       if (v < 0) {
         k = lits + 2;
         assert (w.clause->pos <= size);
-        while (k != middle && (v = val (r = *k)) < 0)
-          k++;
+        k = search_replacement (k, middle, r, v);
       }
 
       assert (lits + 2 <= k), assert (k <= w.clause->end ());
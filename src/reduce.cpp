@@ -219,17 +219,43 @@ void Internal::reduce () {
   bool flush = flushing ();
   if (flush)
     stats.flush.count++;
+  const bool lazy = !flush && opts.reducelazy;
 
   if (!propagate_out_of_order_units ())
     goto DONE;
 
-  mark_satisfied_clauses_as_garbage ();
+  // With 'opts.reducelazy' we do not necessarily collect garbage clauses
+  // right away but only if they make up a large enough fraction of all
+  // clauses.  Until then, garbage long clauses are removed lazily from the
+  // watch lists during propagation, while remaining garbage binary clauses
+  // are still propagated, which is sound, until the next collection.  This
+  // avoids walking all watch lists after each 'reduce', which is a large
+  // fixed cost for many short incremental 'solve' calls.  Since removing
+  // falsified literals from satisfied clauses relies on flushing watches
+  // afterwards, we leave that to 'garbage_collection' in this mode.
+  //
+  if (!lazy)
+    mark_satisfied_clauses_as_garbage ();
   protect_reasons ();
   if (flush)
     mark_clauses_to_be_flushed ();
   else
     mark_useless_redundant_clauses_as_garbage ();
-  garbage_collection ();
+
+  if (!lazy ||
+      percent (stats.garbage.clauses, clauses.size ()) >= opts.reducelazy) {
+    const double start = time ();
+    garbage_collection ();
+    stats.reducegc.time += time () - start;
+    stats.reducegc.collected++;
+  } else {
+    PHASE ("reduce", stats.reductions,
+           "skipping collection of %" PRId64 " garbage clauses %.0f%%",
+           stats.garbage.clauses,
+           percent (stats.garbage.clauses, clauses.size ()));
+    stats.reducegc.skipped++;
+    unprotect_reasons ();
+  }
 
   {
     int64_t delta = opts.reduceint;
@@ -158,6 +158,37 @@ uint64_t current_resident_set_size () {
   return scanned == 2 ? rss * sysconf (_SC_PAGESIZE) : 0;
 }
 
+#endif
+
+/*------------------------------------------------------------------------*/
+
+// Memory backed by (transparent) huge pages, which is what we hope to get
+// for the arena with 'opts.arenahuge'.  This is only available on Linux
+// through the '/proc' file system and otherwise we just return zero.
+
+#ifdef __linux__
+
+uint64_t huge_pages_resident_set_size () {
+  FILE *file = fopen ("/proc/self/smaps_rollup", "r");
+  if (!file)
+    return 0;
+  uint64_t res = 0;
+  char line[128];
+  while (fgets (line, sizeof line, file)) {
+    uint64_t kb;
+    if (sscanf (line, "AnonHugePages: %" PRIu64 " kB", &kb) == 1) {
+      res = kb << 10;
+      break;
+    }
+  }
+  fclose (file);
+  return res;
+}
+
+#else
+
+uint64_t huge_pages_resident_set_size () { return 0; }
+
 #endif
 
     /*------------------------------------------------------------------------*/
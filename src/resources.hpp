@@ -10,6 +10,7 @@ double absolute_process_time ();
 
 uint64_t maximum_resident_set_size ();
 uint64_t current_resident_set_size ();
+uint64_t huge_pages_resident_set_size ();
 
 } // namespace CaDiCaL
 
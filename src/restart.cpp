@@ -166,7 +166,15 @@ void Internal::restart () {
   if (stable)
     stats.restartstable++;
   LOG ("restart %" PRId64 "", stats.restarts);
-  backtrack (reuse_trail ());
+
+  // Clauses from a connected importer are only imported at the root level,
+  // thus trail reuse is given up if there is something to import.
+  //
+  if (external->importer && !proof && external->importer->importing ()) {
+    backtrack ();
+    external->import_clauses ();
+  } else
+    backtrack (reuse_trail ());
 
   lim.restart = stats.conflicts + opts.restartint;
   LOG ("new restart limit at %" PRId64 " conflicts", lim.restart);
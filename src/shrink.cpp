@@ -244,6 +244,8 @@ unsigned inline Internal::shrink_along_reason (int uip, int blevel,
 
   if (opts.minimizeticks)
     stats.ticks.search[stable]++;
+  if (opts.cprofile)
+    cprofile.current.shrink++;
 
   if (resolve_large_clauses || v.reason->size == 2) {
     const Clause &c = *v.reason;
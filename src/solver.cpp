@@ -1043,6 +1043,33 @@ void Solver::disconnect_learner () {
 
 /*===== IPASIR END =======================================================*/
 
+void Solver::connect_importer (Importer *importer) {
+  LOG_API_CALL_BEGIN ("connect_importer");
+  REQUIRE_VALID_STATE ();
+  REQUIRE (importer, "can not connect zero importer");
+#ifdef LOGGING
+  if (external->importer)
+    LOG ("connecting new importer (disconnecting previous one)");
+  else
+    LOG ("connecting new importer (no previous one)");
+#endif
+  external->importer = importer;
+  LOG_API_CALL_END ("connect_importer");
+}
+
+void Solver::disconnect_importer () {
+  LOG_API_CALL_BEGIN ("disconnect_importer");
+  REQUIRE_VALID_STATE ();
+#ifdef LOGGING
+  if (external->importer)
+    LOG ("disconnecting previous importer");
+  else
+    LOG ("ignoring to disconnect importer (no previous one)");
+#endif
+  external->importer = 0;
+  LOG_API_CALL_END ("disconnect_importer");
+}
+
 void Solver::connect_fixed_listener (
     FixedAssignmentListener *fixed_listener) {
   LOG_API_CALL_BEGIN ("connect_fixed_listener");
@@ -1745,6 +1772,28 @@ const char *Solver::write_extension (const char *path) {
   return res;
 }
 
+const char *Solver::write_conflict_profile (const char *path) {
+  LOG_API_CALL_BEGIN ("write_conflict_profile", path);
+  REQUIRE_VALID_STATE ();
+  const char *res = 0;
+  File *file = File::write (internal, path);
+  if (file) {
+    if (!internal->write_cprofile (file))
+      res = internal->error_message.init (
+          "writing to conflict profile file '%s' failed", path);
+    delete file;
+  } else
+    res = internal->error_message.init (
+        "failed to open conflict profile file '%s' for writing", path);
+#ifndef QUIET
+  if (!res)
+    MSG ("wrote profile of %" PRId64 " conflicts",
+         internal->cprofile.conflicts);
+#endif
+  LOG_API_CALL_RETURNS ("write_conflict_profile", path, res);
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 struct ClauseCopier : public ClauseIterator {
@@ -1775,6 +1824,10 @@ void Solver::copy (Solver &other) const {
   REQUIRE_READY_STATE ();
   REQUIRE (other.state () & CONFIGURING, "target solver already modified");
   internal->opts.copy (other.internal->opts);
+  // Declare all variables first as otherwise adding the clauses fails if
+  // checking for declared variables is enabled ('opts.factorcheck').
+  if (external->max_var)
+    (void) other.declare_more_variables (external->max_var);
   ClauseCopier clause_copier (other);
   traverse_clauses (clause_copier);
   WitnessCopier witness_copier (other.external);
@@ -1842,6 +1895,10 @@ void Solver::error (const char *fmt, ...) {
   va_end (ap);
 }
 
+// Thread-safe, thus neither traced nor checking the state.
+
+Solver::Progress Solver::progress () const { return internal->progress (); }
+
 int64_t Solver::get_statistic_value (const char *opt) const {
   REQUIRE_INITIALIZED ();
   if (!strcmp (opt, "conflicts"))
@@ -1866,6 +1923,10 @@ int64_t Solver::get_statistic_value (const char *opt) const {
            internal->stats.all.fasteliminated;
   if (!strcmp (opt, "subsitutued"))
     return internal->stats.all.substituted;
+  if (!strcmp (opt, "imported"))
+    return internal->stats.imported.units +
+           internal->stats.imported.binaries +
+           internal->stats.imported.clauses;
   return -1;
 }
 } // namespace CaDiCaL
@@ -224,6 +224,11 @@ void Stats::print (Internal *internal) {
          stats.elimres, relative (stats.elimres, stats.all.eliminated));
     PRT ("  elimrestried:  %15" PRId64 "   %10.2f %%  per resolution",
          stats.elimrestried, percent (stats.elimrestried, stats.elimres));
+    PRT ("  elimchecked:   %15" PRId64 "   %10.2f %%  per tried",
+         stats.elimchecked, percent (stats.elimchecked, stats.elimtried));
+    PRT ("  elimcheckused: %15" PRId64 "   %10.2f %%  per checked",
+         stats.elimcheckused,
+         percent (stats.elimcheckused, stats.elimchecked));
     PRT ("  def checked:   %15" PRId64 "   %10.2f    per phase",
          stats.definitions_checked,
          relative (stats.definitions_checked, stats.elimphases));
@@ -322,6 +327,23 @@ void Stats::print (Internal *internal) {
     PRT ("  flushings:     %15" PRId64 "   %10.2f    interval",
          stats.flush.count, relative (stats.conflicts, stats.flush.count));
   }
+  {
+    const int64_t imported = stats.imported.units +
+                             stats.imported.binaries +
+                             stats.imported.clauses;
+    if (all || imported) {
+      PRT ("imported:        %15" PRId64 "   %10.2f    per restart",
+           imported, relative (imported, stats.restarts));
+      PRT ("  importunits:   %15" PRId64 "   %10.2f %%  imported",
+           stats.imported.units, percent (stats.imported.units, imported));
+      PRT ("  importbins:    %15" PRId64 "   %10.2f %%  imported",
+           stats.imported.binaries,
+           percent (stats.imported.binaries, imported));
+      PRT ("  importskip:    %15" PRId64 "   %10.2f    per imported",
+           stats.imported.skipped,
+           relative (stats.imported.skipped, imported));
+    }
+  }
   if (all || stats.instantiated) {
     PRT ("instantiated:    %15" PRId64 "   %10.2f %%  of tried",
          stats.instantiated, percent (stats.instantiated, stats.instried));
@@ -334,6 +356,11 @@ void Stats::print (Internal *internal) {
          percent (stats.learned.clauses, stats.conflicts));
     PRT ("  bumped:        %15" PRId64 "   %10.2f    per learned",
          stats.bumped, relative (stats.bumped, stats.learned.clauses));
+    PRT ("  scorebumped:   %15" PRId64 "   %10.2f    per learned",
+         stats.scorebumped,
+         relative (stats.scorebumped, stats.learned.clauses));
+    PRT ("  heapified:     %15" PRId64 "   %10.2f %%  of conflicts",
+         stats.heapified, percent (stats.heapified, stats.conflicts));
     PRT ("  recomputed:    %15" PRId64 "   %10.2f %%  per learned",
          stats.recomputed,
          percent (stats.recomputed, stats.learned.clauses));
@@ -387,6 +414,9 @@ void Stats::print (Internal *internal) {
   PRT ("minishrunken:    %15" PRId64 "   %10.2f %%  learned literals",
        stats.minishrunken,
        percent (stats.minishrunken, stats.learned.literals));
+  PRT ("binminimized:    %15" PRId64 "   %10.2f %%  learned literals",
+       stats.binminimized,
+       percent (stats.binminimized, stats.learned.literals));
 
   if (all || stats.conflicts) {
     PRT ("otfs:            %15" PRId64 "   %10.2f %%  of conflict",
@@ -418,6 +448,25 @@ void Stats::print (Internal *internal) {
   PRT ("  vivifyprops:   %15" PRId64 "   %10.2f %%  of propagations",
        stats.propagations.vivify,
        percent (stats.propagations.vivify, propagations));
+  if (all || stats.prefetched.watches) {
+    PRT ("  prefetchws:    %15" PRId64 "   %10.2f    per searchprop",
+         stats.prefetched.watches,
+         relative (stats.prefetched.watches, stats.propagations.search));
+    PRT ("  prefetchcls:   %15" PRId64 "   %10.2f    per searchprop",
+         stats.prefetched.clauses,
+         relative (stats.prefetched.clauses, stats.propagations.search));
+  }
+  if (all || stats.trailsave.saved) {
+    PRT ("  trailsaved:    %15" PRId64 "   %10.2f    per conflict",
+         stats.trailsave.saved,
+         relative (stats.trailsave.saved, stats.conflicts));
+    PRT ("  trailreplayed: %15" PRId64 "   %10.2f %%  of searchprops",
+         stats.trailsave.replayed,
+         percent (stats.trailsave.replayed, stats.propagations.search));
+    PRT ("  trailconflicts:%15" PRId64 "   %10.2f %%  of conflicts",
+         stats.trailsave.conflicts,
+         percent (stats.trailsave.conflicts, stats.conflicts));
+  }
   if (all || stats.reactivated) {
     PRT ("reactivated:     %15" PRId64 "   %10.2f %%  of all variables",
          stats.reactivated, percent (stats.reactivated, stats.vars));
@@ -435,6 +484,13 @@ void Stats::print (Internal *internal) {
          relative (stats.reduced_prct, stats.reductions));
     PRT ("  collections:   %15" PRId64 "   %10.2f    interval",
          stats.collections, relative (stats.conflicts, stats.collections));
+    PRT ("  lazyskipped:   %15" PRId64 "   %10.2f %%  reductions",
+         stats.reducegc.skipped,
+         percent (stats.reducegc.skipped, stats.reductions));
+    PRT ("  lazysaved:     %15.2f   %10.2f    seconds per skip",
+         stats.reducegc.skipped *
+             relative (stats.reducegc.time, stats.reducegc.collected),
+         relative (stats.reducegc.time, stats.reducegc.collected));
   }
   if (all || stats.rephased.total) {
     PRT ("rephased:        %15" PRId64 "   %10.2f    interval",
@@ -507,6 +563,8 @@ void Stats::print (Internal *internal) {
     PRT ("  swept vars:    %15" PRId64 "   %10.2f %%  of all variables",
          stats.sweep_variables,
          percent (stats.sweep_variables, stats.vars));
+    PRT ("  skipped vars:  %15" PRId64 "   %10.2f %%  of all variables",
+         stats.sweep_skipped, percent (stats.sweep_skipped, stats.vars));
     PRT ("  sweep units:   %15" PRId64 "   %10.2f %%  of all variables",
          stats.sweep_units, percent (stats.sweep_units, stats.vars));
     PRT ("  solved:        %15" PRId64 "   %10.2f    per swept variable",
@@ -705,6 +763,9 @@ void Stats::print (Internal *internal) {
     PRT ("  vivifysched:   %15" PRId64 "   %10.2f %%  checks per scheduled",
          stats.vivifysched,
          percent (stats.vivifychecks, stats.vivifysched));
+    PRT ("  vivifyskipped: %15" PRId64 "   %10.2f %%  per scheduled",
+         stats.vivifyskipped,
+         percent (stats.vivifyskipped, stats.vivifysched));
     PRT ("  vivifyunits:   %15" PRId64 "   %10.2f %%  per vivify check",
          stats.vivifyunits,
          percent (stats.vivifyunits, stats.vivifychecks));
@@ -857,6 +918,11 @@ void Internal::print_resource_usage () {
        internal->real_time ());
   MSG ("maximum resident set size of process:    %12.2f    MB",
        m / (double) (1l << 20));
+  if (opts.arenahuge) {
+    uint64_t h = huge_pages_resident_set_size ();
+    MSG ("huge pages backed memory of process:     %12.2f    MB",
+         h / (double) (1l << 20));
+  }
 #endif
 }
 
@@ -29,6 +29,17 @@ struct Stats {
     int64_t backbone = 0;    // propagated during backbones
   } propagations;
 
+  struct {
+    int64_t watches = 0; // prefetched watch lists in 'propagate'
+    int64_t clauses = 0; // prefetched clauses in 'propagate'
+  } prefetched;
+
+  struct {
+    int64_t saved = 0;     // saved literals before back-jumps
+    int64_t replayed = 0;  // saved literals replayed in 'propagate'
+    int64_t conflicts = 0; // conflicts found while replaying
+  } trailsave;
+
   struct {
     int64_t search[2] = {0};
     int64_t backbone = 0;
@@ -165,6 +176,8 @@ struct Stats {
   int64_t promoted1 = 0;    // promoted clauses to tier one
   int64_t promoted2 = 0;    // promoted clauses to tier two
   int64_t bumped = 0;       // seen and bumped variables in 'analyze'
+  int64_t scorebumped = 0;  // bumped variable scores in 'analyze'
+  int64_t heapified = 0;    // score heap rebuilds in batched bumping
   int64_t recomputed = 0;   // recomputed glues 'recompute_glue'
   int64_t searched = 0;     // searched decisions in 'decide'
   int64_t reductions = 0;   // 'reduce' counter
@@ -173,6 +186,11 @@ struct Stats {
   int64_t reduced_prct = 0;
   int64_t collected = 0;    // number of collected bytes
   int64_t collections = 0;  // number of garbage collections
+  struct {
+    int64_t skipped = 0; // lazily skipped collections after 'reduce'
+    int64_t collected = 0; // garbage collections after 'reduce'
+    double time = 0;       // time of collections after 'reduce'
+  } reducegc;
   int64_t hbrs = 0;         // hyper binary resolvents
   int64_t hbrsizes = 0;     // sum of hyper resolved base clauses
   int64_t hbreds = 0;       // redundant hyper binary resolvents
@@ -233,6 +251,8 @@ struct Stats {
   int64_t elimfastphases = 0; // number of scheduled elimination phases
   int64_t elimcompleted = 0;  // number complete elimination procedures
   int64_t elimtried = 0;      // number of variable elimination attempts
+  int64_t elimchecked = 0;    // resolvents counted in parallel
+  int64_t elimcheckused = 0;  // parallel resolvent counts used
   int64_t elimsubst = 0;  // number of eliminations through substitutions
   int64_t elimgates = 0;  // number of gates found during elimination
   int64_t elimequivs = 0; // number of equivalences found during elimination
@@ -259,6 +279,7 @@ struct Stats {
       0; // subsumed clauses during sorting in vivification
   int64_t vivifyreused = 0;  // reused vivification decisions
   int64_t vivifysched = 0;   // scheduled clauses for vivification
+  int64_t vivifyskipped = 0; // skipped after parallel check
   int64_t vivifysubs = 0;    // subsumed clauses during vivification
   int64_t vivifysubred = 0;  // subsumed clauses during vivification
   int64_t vivifysubirr = 0;  // subsumed clauses during vivification
@@ -280,6 +301,7 @@ struct Stats {
   int64_t minimized = 0;    // minimized literals
   int64_t shrunken = 0;     // shrunken literals
   int64_t minishrunken = 0; // shrunken during minimization literals
+  int64_t binminimized = 0; // minimized literals through binaries
 
   int64_t irrlits = 0; // literals in irredundant clauses
   struct {
@@ -288,6 +310,13 @@ struct Stats {
     int64_t literals = 0;
   } garbage;
 
+  struct {
+    int64_t units = 0;    // imported units (and empty clauses)
+    int64_t binaries = 0; // imported binary clauses
+    int64_t clauses = 0;  // imported larger clauses
+    int64_t skipped = 0;  // skipped satisfied or inactive clauses
+  } imported;
+
   int64_t sweep_units = 0;
   int64_t sweep_flip_backbone = 0;
   int64_t sweep_fixed_backbone = 0;
@@ -304,6 +333,7 @@ struct Stats {
   int64_t sweep_solved_equivalences = 0;
   int64_t sweep_equivalences = 0;
   int64_t sweep_variables = 0;
+  int64_t sweep_skipped = 0;
   int64_t sweep_completed = 0;
   int64_t sweep_solved = 0;
   int64_t sweep_sat = 0;
@@ -1,5 +1,7 @@
 #include "internal.hpp"
 
+#include <atomic>
+
 namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
@@ -181,8 +183,15 @@ void Internal::strengthen_clause (Clause *c, int lit) {
 // strengthened the result is negative.  Otherwise the candidate clause
 // can not be subsumed nor strengthened and zero is returned.
 
+// If 'tails' is non-zero the occurrence lists of 'c' were already checked
+// in parallel up to the sizes given by 'tails' (see 'subsume_check_chunk'),
+// which are skipped here.  There are four entries for each literal of 'c',
+// which are zero if the literal was not flagged during the parallel check,
+// since committing earlier candidates of the chunk might have flagged it.
+
 inline int Internal::try_to_subsume_clause (Clause *c,
-                                            vector<Clause *> &shrunken) {
+                                            vector<Clause *> &shrunken,
+                                            const unsigned *tails) {
 
   stats.subtried++;
   assert (!level);
@@ -201,8 +210,11 @@ inline int Internal::try_to_subsume_clause (Clause *c,
     // need to check occurrences of these variables.  The occurrence lists
     // of other literal do not have to be checked.
     //
-    if (!flags (lit).subsume)
+    if (!flags (lit).subsume) {
+      if (tails)
+        tails += 4;
       continue;
+    }
 
     for (int sign = -1; !d && sign <= 1; sign += 2) {
 
@@ -220,7 +232,10 @@ inline int Internal::try_to_subsume_clause (Clause *c,
       // literal which can be removed in 'c', otherwise to 'INT_MIN' which
       // is a non-valid literal.
 
-      for (const auto &bin : bins (sign * lit)) {
+      const Bins &bs = bins (sign * lit);
+      const auto bins_begin = bs.begin () + (tails ? *tails++ : 0);
+      for (auto b = bins_begin; b != bs.end (); b++) {
+        const auto &bin = *b;
         const auto &other = bin.lit;
         const int tmp = marked (other);
         if (!tmp)
@@ -261,7 +276,9 @@ inline int Internal::try_to_subsume_clause (Clause *c,
       // code after the loop is used.
       //
       const Occs &os = occs (sign * lit);
-      for (const auto &e : os) {
+      const auto occs_begin = os.begin () + (tails ? *tails++ : 0);
+      for (auto o = occs_begin; o != os.end (); o++) {
+        Clause *e = *o;
         assert (!e->garbage); // sanity check
         if (e->garbage)
           continue; // defensive: not needed
@@ -279,6 +296,15 @@ inline int Internal::try_to_subsume_clause (Clause *c,
 
   unmark (c);
 
+  return subsume_or_strengthen_clause (c, d, flipped, shrunken);
+}
+
+// Apply the result of searching for a clause 'd' which subsumes
+// ('flipped == INT_MIN') or strengthens the candidate clause 'c'.
+
+int Internal::subsume_or_strengthen_clause (Clause *c, Clause *d,
+                                            int flipped,
+                                            vector<Clause *> &shrunken) {
   if (flipped == INT_MIN) {
     LOG (d, "subsuming");
     subsume_clause (d, c);
@@ -324,6 +350,254 @@ struct subsume_less_noccs {
 
 /*------------------------------------------------------------------------*/
 
+// Connect a scheduled clause, which was not subsumed, as one-watch.
+
+void Internal::subsume_connect_clause (Clause *c) {
+
+  // If not subsumed connect smallest occurring literal, where occurring
+  // means the number of times it was used to connect (as a one-watch) a
+  // previous smaller or equal sized clause.  This minimizes the length of
+  // the occurrence lists traversed during 'try_to_subsume_clause'. Also
+  // note that this number is usually way smaller than the number of
+  // occurrences computed before and stored in 'noccs'.
+  //
+  int minlit = 0;
+  int64_t minoccs = 0;
+  size_t minsize = 0;
+  bool subsume = true;
+  bool binary = (c->size == 2 && !c->redundant);
+
+  for (const auto &lit : *c) {
+
+    if (!flags (lit).subsume)
+      subsume = false;
+    const size_t size = binary ? bins (lit).size () : occs (lit).size ();
+    if (minlit && minsize <= size)
+      continue;
+    const int64_t tmp = noccs (lit);
+    if (minlit && minsize == size && tmp <= minoccs)
+      continue;
+    minlit = lit, minsize = size, minoccs = tmp;
+  }
+
+  // If there is a variable in a clause different from is not 'subsume'
+  // (has been added since the last subsumption round), then this clause
+  // can not serve to strengthen or subsume another clause, since all
+  // shrunken or added clauses mark all their variables as 'subsume'.
+  //
+  if (!subsume)
+    return;
+
+  if (!binary) {
+
+    // If smallest occurring literal occurs too often do not connect.
+    //
+    if (minsize > (size_t) opts.subsumeocclim)
+      return;
+
+    LOG (c,
+         "watching %d with %zd current and total %" PRId64 " occurrences",
+         minlit, minsize, minoccs);
+
+    occs (minlit).push_back (c);
+
+    // This sorting should give faster failures for assumption checks
+    // since the less occurring variables are put first in a clause and
+    // thus will make it more likely to be found as witness for a clause
+    // not to be subsuming.  One could in principle (see also the
+    // discussion on 'subsumption' in our 'Splatz' solver) replace marking
+    // by a kind of merge sort, as also suggested by Bayardo.  It would
+    // avoid 'marked' calls and thus might be slightly faster but could
+    // not take benefit of this sorting optimization.
+    //
+    sort (c->begin (), c->end (), subsume_less_noccs (this));
+
+  } else {
+
+    // If smallest occurring literal occurs too often do not connect.
+    //
+    if (minsize > (size_t) opts.subsumebinlim)
+      return;
+
+    LOG (c,
+         "watching %d with %zd current binary and total %" PRId64
+         " occurrences",
+         minlit, minsize, minoccs);
+
+    const int minlit_pos = (c->literals[1] == minlit);
+    const int other = c->literals[!minlit_pos];
+    bins (minlit).push_back (Bin{other, c->id});
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// With 'opts.subsumethreads' positive, forward checks are performed in
+// parallel for chunks of consecutive scheduled clauses.  Each candidate in
+// the chunk is checked against the clauses connected before the chunk
+// started, which during the check are only read.  Afterwards subsumption,
+// strengthening and connecting are applied sequentially in schedule order.
+// If no subsuming or strengthening clause was found in parallel, only the
+// clauses connected within the chunk still need to be checked, which are
+// found at the end of the occurrence lists ('tails').  Since chunks do not
+// depend on the number of threads, neither does the result.
+
+struct SubsumeCheck {
+  Clause *candidate;
+  Clause *subsuming;      // non-binary clause found or zero
+  int binary[2];          // literals of binary clause found
+  int64_t id;             // and its identifier
+  int flipped;            // as returned by 'subsume_check'
+  int64_t checks, checks2;
+  vector<unsigned> tails; // occurrence list sizes checked
+};
+
+// Same as 'subsume_check' but with explicit marks and without moving the
+// failing literal to the front, as clauses are shared between threads.
+
+static int subsume_check_marked (const Clause *subsuming,
+                                 const vector<signed char> &marks,
+                                 bool strengthen) {
+  int flipped = 0;
+  for (const auto &lit : *subsuming) {
+    const int tmp = marks[abs (lit)] * sign (lit);
+    if (!tmp)
+      return 0;
+    if (tmp > 0)
+      continue;
+    if (flipped)
+      return 0;
+    flipped = lit;
+  }
+  if (!flipped)
+    return INT_MIN;
+  return strengthen ? flipped : 0;
+}
+
+// Same search as in 'try_to_subsume_clause'.
+
+static void subsume_check_candidate (Internal *internal,
+                                     SubsumeCheck &check,
+                                     vector<signed char> &marks) {
+  const Clause *c = check.candidate;
+  for (const auto &lit : *c)
+    marks[abs (lit)] = sign (lit);
+  const bool strengthen = internal->opts.subsumestr;
+  bool found = false;
+  for (const auto &lit : *c) {
+    if (!internal->flags (lit).subsume) {
+      check.tails.resize (check.tails.size () + 4, 0);
+      continue;
+    }
+    for (int sign = -1; !found && sign <= 1; sign += 2) {
+      const Bins &bs = internal->bins (sign * lit);
+      for (const auto &bin : bs) {
+        const auto &other = bin.lit;
+        const int tmp = marks[abs (other)] * CaDiCaL::sign (other);
+        if (!tmp)
+          continue;
+        if (tmp < 0 && sign < 0)
+          continue;
+        if (tmp < 0) {
+          check.binary[0] = lit;
+          check.flipped = other;
+        } else {
+          check.binary[0] = sign * lit;
+          check.flipped = (sign < 0) ? -lit : INT_MIN;
+        }
+        check.binary[1] = other;
+        check.id = bin.id;
+        found = true;
+        break;
+      }
+      if (found)
+        break;
+      const Occs &os = internal->occs (sign * lit);
+      for (const auto &e : os) {
+        check.checks++;
+        if (e->size == 2)
+          check.checks2++;
+        const int flipped = subsume_check_marked (e, marks, strengthen);
+        if (!flipped)
+          continue;
+        check.subsuming = e;
+        check.flipped = flipped;
+        found = true;
+        break;
+      }
+      if (found)
+        break;
+      check.tails.push_back (bs.size ());
+      check.tails.push_back (os.size ());
+    }
+    if (found)
+      break;
+  }
+  for (const auto &lit : *c)
+    marks[abs (lit)] = 0;
+}
+
+// Check the candidates of the chunk starting at 'begin' in parallel and
+// return the end of the chunk.
+
+static size_t subsume_check_chunk (Internal *internal,
+                                   const vector<ClauseSize> &schedule,
+                                   size_t begin,
+                                   vector<SubsumeCheck> &checks,
+                                   vector<vector<signed char>> &marks) {
+  const size_t end = min (begin + (1u << 12), schedule.size ());
+  checks.clear ();
+  for (size_t i = begin; i < end; i++) {
+    Clause *c = schedule[i].clause;
+    if (c->size <= 2 || !c->subsume)
+      continue;
+    checks.push_back (SubsumeCheck ());
+    SubsumeCheck &check = checks.back ();
+    check.candidate = c;
+    check.subsuming = 0;
+    check.binary[0] = check.binary[1] = 0;
+    check.id = 0;
+    check.flipped = 0;
+    check.checks = check.checks2 = 0;
+  }
+  const size_t size = checks.size ();
+  const size_t workers = min ((size_t) internal->opts.subsumethreads, size);
+  while (marks.size () < workers)
+    marks.push_back (vector<signed char> (internal->max_var + 1, 0));
+  std::atomic<size_t> next (0);
+  internal->pool.run (workers, [&] (size_t worker) {
+    size_t i;
+    while ((i = next++) < size)
+      subsume_check_candidate (internal, checks[i], marks[worker]);
+  });
+  return end;
+}
+
+// Apply the parallel check of candidate 'c'.
+
+static int subsume_checked_clause (Internal *internal, Clause *c,
+                                   const SubsumeCheck &check,
+                                   vector<Clause *> &shrunken) {
+  assert (check.candidate == c);
+  internal->stats.subchecks += check.checks;
+  internal->stats.subchecks2 += check.checks2;
+  if (!check.flipped)
+    return internal->try_to_subsume_clause (c, shrunken,
+                                            check.tails.data ());
+  internal->stats.subtried++;
+  Clause *d = check.subsuming;
+  if (!d) {
+    d = internal->dummy_binary;
+    d->literals[0] = check.binary[0];
+    d->literals[1] = check.binary[1];
+    d->id = check.id;
+  }
+  return internal->subsume_or_strengthen_clause (c, d, check.flipped,
+                                                 shrunken);
+}
+
+/*------------------------------------------------------------------------*/
+
 // Usually called from 'subsume' below if 'subsuming' triggered it.  Then
 // the idea is to subsume both redundant and irredundant clauses. It is also
 // called in the elimination loop in 'elim' in which case we focus on
@@ -452,14 +726,24 @@ bool Internal::subsume_round () {
   init_occs ();
   init_bins ();
 
-  for (const auto &s : schedule) {
+  const bool parallel = opts.subsumethreads > 0;
+  vector<SubsumeCheck> checks;
+  vector<vector<signed char>> marks;
+  size_t chunk = 0, next = 0;
+
+  for (size_t i = 0; i < schedule.size (); i++) {
 
     if (terminated_asynchronously ())
       break;
     if (stats.subchecks >= check_limit)
       break;
 
-    Clause *c = s.clause;
+    if (parallel && i == chunk) {
+      chunk = subsume_check_chunk (this, schedule, i, checks, marks);
+      next = 0;
+    }
+
+    Clause *c = schedule[i].clause;
     assert (!c->garbage);
 
     checked++;
@@ -474,7 +758,11 @@ bool Internal::subsume_round () {
     //
     if (c->size > 2 && c->subsume) {
       c->subsume = false;
-      const int tmp = try_to_subsume_clause (c, shrunken);
+      int tmp;
+      if (parallel)
+        tmp = subsume_checked_clause (this, c, checks[next++], shrunken);
+      else
+        tmp = try_to_subsume_clause (c, shrunken);
       if (tmp > 0) {
         subsumed++;
         continue;
@@ -483,80 +771,7 @@ bool Internal::subsume_round () {
         strengthened++;
     }
 
-    // If not subsumed connect smallest occurring literal, where occurring
-    // means the number of times it was used to connect (as a one-watch) a
-    // previous smaller or equal sized clause.  This minimizes the length of
-    // the occurrence lists traversed during 'try_to_subsume_clause'. Also
-    // note that this number is usually way smaller than the number of
-    // occurrences computed before and stored in 'noccs'.
-    //
-    int minlit = 0;
-    int64_t minoccs = 0;
-    size_t minsize = 0;
-    bool subsume = true;
-    bool binary = (c->size == 2 && !c->redundant);
-
-    for (const auto &lit : *c) {
-
-      if (!flags (lit).subsume)
-        subsume = false;
-      const size_t size = binary ? bins (lit).size () : occs (lit).size ();
-      if (minlit && minsize <= size)
-        continue;
-      const int64_t tmp = noccs (lit);
-      if (minlit && minsize == size && tmp <= minoccs)
-        continue;
-      minlit = lit, minsize = size, minoccs = tmp;
-    }
-
-    // If there is a variable in a clause different from is not 'subsume'
-    // (has been added since the last subsumption round), then this clause
-    // can not serve to strengthen or subsume another clause, since all
-    // shrunken or added clauses mark all their variables as 'subsume'.
-    //
-    if (!subsume)
-      continue;
-
-    if (!binary) {
-
-      // If smallest occurring literal occurs too often do not connect.
-      //
-      if (minsize > (size_t) opts.subsumeocclim)
-        continue;
-
-      LOG (c,
-           "watching %d with %zd current and total %" PRId64 " occurrences",
-           minlit, minsize, minoccs);
-
-      occs (minlit).push_back (c);
-
-      // This sorting should give faster failures for assumption checks
-      // since the less occurring variables are put first in a clause and
-      // thus will make it more likely to be found as witness for a clause
-      // not to be subsuming.  One could in principle (see also the
-      // discussion on 'subsumption' in our 'Splatz' solver) replace marking
-      // by a kind of merge sort, as also suggested by Bayardo.  It would
-      // avoid 'marked' calls and thus might be slightly faster but could
-      // not take benefit of this sorting optimization.
-      //
-      sort (c->begin (), c->end (), subsume_less_noccs (this));
-
-    } else {
-
-      // If smallest occurring literal occurs too often do not connect.
-      //
-      if (minsize > (size_t) opts.subsumebinlim)
-        continue;
-
-      LOG (c,
-           "watching %d with %zd current binary and total %" PRId64
-           " occurrences",
-           minlit, minsize, minoccs);
-
-      const int minlit_pos = (c->literals[1] == minlit);
-      const int other = c->literals[!minlit_pos];
-      bins (minlit).push_back (Bin{other, c->id});
-    }
+    subsume_connect_clause (c);
   }
 
   PHASE ("subsume-round", stats.subsumerounds,
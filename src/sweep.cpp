@@ -1,9 +1,11 @@
 #include "internal.hpp"
 
+#include <atomic>
+
 namespace CaDiCaL {
 
 Sweeper::Sweeper (Internal *i)
-    : internal (i), random (internal->opts.seed) {
+    : SweepEnvironment (i->opts.seed), internal (i) {
   random += internal->stats.sweep; // different seed every time
   internal->init_sweeper (*this);
 }
@@ -14,6 +16,10 @@ Sweeper::~Sweeper () {
   return;
 }
 
+void Sweeper::add_clause (unsigned depth, Clause *c, int) {
+  internal->sweep_clause (*this, depth, c);
+}
+
 #define INVALID64 INT64_MAX
 #define INVALID UINT_MAX
 
@@ -227,6 +233,7 @@ void Internal::init_sweeper (Sweeper &sweeper) {
       2 + 2 * cache_lines (clauses.size (), sizeof (Clause *));
   assert (!citten);
   citten = kitten_init ();
+  sweeper.citten = citten;
   citten_clear_track_log_terminate ();
 
   sweep_dense_mode_and_watch_irredundant (); // full occurence list
@@ -285,7 +292,7 @@ void Internal::release_sweeper (Sweeper &sweeper) {
     erase_vector (sweeper.core[i]);
 
   kitten_release (citten);
-  citten = 0;
+  sweeper.citten = citten = 0;
   stats.ticks.sweep += sweeper.current_ticks;
   sweep_sparse_mode ();
   return;
@@ -336,31 +343,32 @@ int Internal::sweep_repr (Sweeper &sweeper, int lit) {
   return res;
 }
 
-void Internal::add_literal_to_environment (Sweeper &sweeper, unsigned depth,
-                                           int lit) {
-  const int repr = sweep_repr (sweeper, lit);
+void Internal::add_literal_to_environment (SweepEnvironment &env,
+                                           unsigned depth, int lit) {
+  const int repr = env.repr (lit);
   if (repr != lit)
     return;
   const int idx = abs (lit);
-  if (sweeper.depths[idx])
+  if (env.depths[idx])
     return;
   assert (depth < UINT_MAX);
-  sweeper.depths[idx] = depth + 1;
+  env.depths[idx] = depth + 1;
   assert (idx);
-  sweeper.vars.push_back (idx);
+  env.vars.push_back (idx);
   LOG ("sweeping[%u] adding literal %d", depth, lit);
 }
 
-void Internal::sweep_add_clause (Sweeper &sweeper, unsigned depth) {
+void Internal::sweep_add_clause (SweepEnvironment &env, unsigned depth,
+                                 unsigned id) {
   // TODO: assertion fails, check if this an issue or can be avoided
-  // assert (sweeper.clause.size () > 1);
-  for (const auto &lit : sweeper.clause)
-    add_literal_to_environment (sweeper, depth, lit);
-  citten_clause_with_id (citten, sweeper.clauses.size (),
-                         sweeper.clause.size (), sweeper.clause.data ());
-  sweeper.clause.clear ();
-  if (opts.sweepcountbinary || sweeper.clause.size () > 2)
-    sweeper.encoded++;
+  // assert (env.clause.size () > 1);
+  for (const auto &lit : env.clause)
+    add_literal_to_environment (env, depth, lit);
+  citten_clause_with_id (env.citten, id, env.clause.size (),
+                         env.clause.data ());
+  env.clause.clear ();
+  if (opts.sweepcountbinary || env.clause.size () > 2)
+    env.encoded++;
 }
 
 void Internal::sweep_clause (Sweeper &sweeper, unsigned depth, Clause *c) {
@@ -385,10 +393,82 @@ void Internal::sweep_clause (Sweeper &sweeper, unsigned depth, Clause *c) {
     sweeper.clause.push_back (lit);
   }
   c->swept = true;
-  sweep_add_clause (sweeper, depth);
+  sweep_add_clause (sweeper, depth, sweeper.clauses.size ());
   sweeper.clauses.push_back (c);
 }
 
+// Adds the clauses around 'start' to the environment in breadth-first
+// order (randomized with 'sweeprand') until the depth limit is reached or
+// all clauses are copied.  Returns whether the variable or clause limit
+// was hit instead.  This is shared by 'sweep_variable' and the parallel
+// workers.
+
+bool Internal::sweep_environment (SweepEnvironment &env, int start,
+                                  unsigned &depth, uint64_t &ticks) {
+  assert (env.vars.empty ());
+  assert (!env.encoded);
+  LOG ("starting sweeping[0]");
+  add_literal_to_environment (env, 0, start);
+  LOG ("finished sweeping[0]");
+  LOG ("starting sweeping[1]");
+
+  bool limit_reached = false;
+  size_t expand = 0, next = 1;
+  depth = 1;
+
+  while (!limit_reached) {
+    if (env.encoded >= env.limit.clauses) {
+      LOG ("environment clause limit reached");
+      limit_reached = true;
+      break;
+    }
+    if (expand == next) {
+      LOG ("finished sweeping[%u]", depth);
+      if (depth >= env.limit.depth) {
+        LOG ("environment depth limit reached");
+        break;
+      }
+      next = env.vars.size ();
+      if (expand == next) {
+        LOG ("completely copied all clauses");
+        break;
+      }
+      depth++;
+      LOG ("starting sweeping[%u]", depth);
+    }
+    const unsigned choices = next - expand;
+    if (opts.sweeprand && choices > 1) {
+      const unsigned swaps = env.random.pick_int (0, choices - 1);
+      if (swaps) {
+        assert (expand + swaps < env.vars.size ());
+        swap (env.vars[expand], env.vars[expand + swaps]);
+      }
+    }
+    const int idx = env.vars[expand];
+    LOG ("traversing and adding clauses of %d", idx);
+    for (unsigned sign = 0; sign < 2; sign++) {
+      const int lit = sign ? -idx : idx;
+      const Occs &ns = occs (lit);
+      ticks += 1 + cache_lines (ns.size (), sizeof (Clause *));
+      for (auto c : ns) {
+        ticks++;
+        if (!can_sweep_clause (c))
+          continue;
+        env.add_clause (depth, c, idx);
+        if (env.vars.size () >= env.limit.vars) {
+          LOG ("environment variable limit reached");
+          limit_reached = true;
+          break;
+        }
+      }
+      if (limit_reached)
+        break;
+    }
+    expand++;
+  }
+  return limit_reached;
+}
+
 extern "C" {
 static void save_core_clause (void *state, unsigned id, bool learned,
                               size_t size, const unsigned *lits) {
@@ -625,26 +705,26 @@ void Internal::save_add_clear_core (Sweeper &sweeper) {
   clear_core (sweeper, 0);
 }
 
-void Internal::init_backbone_and_partition (Sweeper &sweeper) {
+void Internal::init_backbone_and_partition (SweepEnvironment &env) {
   LOG ("initializing backbone and equivalent literals candidates");
-  sweeper.backbone.clear ();
-  sweeper.partition.clear ();
-  for (const auto &idx : sweeper.vars) {
+  env.backbone.clear ();
+  env.partition.clear ();
+  for (const auto &idx : env.vars) {
     if (!active (idx))
       continue;
     assert (idx > 0);
     const int lit = idx;
     const int not_lit = -lit;
-    const signed char tmp = kitten_signed_value (citten, lit);
+    const signed char tmp = kitten_signed_value (env.citten, lit);
     const int candidate = (tmp < 0) ? not_lit : lit;
     LOG ("sweeping candidate %d", candidate);
-    sweeper.backbone.push_back (candidate);
-    sweeper.partition.push_back (candidate);
+    env.backbone.push_back (candidate);
+    env.partition.push_back (candidate);
   }
-  sweeper.partition.push_back (0);
+  env.partition.push_back (0);
 
-  LOG (sweeper.backbone, "initialized backbone candidates");
-  LOG (sweeper.partition, "initialized equivalence candidates");
+  LOG (env.backbone, "initialized backbone candidates");
+  LOG (env.partition, "initialized equivalence candidates");
 }
 
 void Internal::sweep_empty_clause (Sweeper &sweeper) {
@@ -653,9 +733,9 @@ void Internal::sweep_empty_clause (Sweeper &sweeper) {
   assert (unsat);
 }
 
-void Internal::sweep_refine_partition (Sweeper &sweeper) {
+void Internal::sweep_refine_partition (SweepEnvironment &env) {
   LOG ("refining partition");
-  vector<int> &old_partition = sweeper.partition;
+  vector<int> &old_partition = env.partition;
   vector<int> new_partition;
   auto old_begin = old_partition.begin ();
   const auto old_end = old_partition.end ();
@@ -667,11 +747,11 @@ void Internal::sweep_refine_partition (Sweeper &sweeper) {
     unsigned assigned_true = 0;
     int other;
     for (q = p; (other = *q) != 0; q++) {
-      if (sweep_repr (sweeper, other) != other)
+      if (env.repr (other) != other)
         continue;
       if (val (other))
         continue;
-      signed char value = kitten_signed_value (citten, other);
+      signed char value = kitten_signed_value (env.citten, other);
       if (!value)
         LOG ("dropping sub-solver unassigned %d", other);
       else if (value > 0) {
@@ -704,11 +784,11 @@ void Internal::sweep_refine_partition (Sweeper &sweeper) {
 
     unsigned assigned_false = 0;
     for (q = p; (other = *q) != 0; q++) {
-      if (sweep_repr (sweeper, other) != other)
+      if (env.repr (other) != other)
         continue;
       if (val (other))
         continue;
-      signed char value = kitten_signed_value (citten, other);
+      signed char value = kitten_signed_value (env.citten, other);
       if (value < 0) {
         new_partition.push_back (other);
         assigned_false++;
@@ -738,33 +818,33 @@ void Internal::sweep_refine_partition (Sweeper &sweeper) {
   LOG ("refined %u classes into %u", old_classes, new_classes);
 }
 
-void Internal::sweep_refine_backbone (Sweeper &sweeper) {
+void Internal::sweep_refine_backbone (SweepEnvironment &env) {
   LOG ("refining backbone candidates");
-  const auto end = sweeper.backbone.end ();
-  auto q = sweeper.backbone.begin ();
+  const auto end = env.backbone.end ();
+  auto q = env.backbone.begin ();
   for (auto p = q; p != end; p++) {
     const int lit = *p;
     if (val (lit))
       continue;
-    signed char value = kitten_signed_value (citten, lit);
+    signed char value = kitten_signed_value (env.citten, lit);
     if (!value)
       LOG ("dropping sub-solver unassigned %d", lit);
     else if (value > 0)
       *q++ = lit;
   }
-  sweeper.backbone.resize (q - sweeper.backbone.begin ());
+  env.backbone.resize (q - env.backbone.begin ());
 }
 
-void Internal::sweep_refine (Sweeper &sweeper) {
-  assert (kitten_status (citten) == 10);
-  if (sweeper.backbone.empty ())
+void Internal::sweep_refine (SweepEnvironment &env) {
+  assert (kitten_status (env.citten) == 10);
+  if (env.backbone.empty ())
     LOG ("no need to refine empty backbone candidates");
   else
-    sweep_refine_backbone (sweeper);
-  if (sweeper.partition.empty ())
+    sweep_refine_backbone (env);
+  if (env.partition.empty ())
     LOG ("no need to refine empty partition candidates");
   else
-    sweep_refine_partition (sweeper);
+    sweep_refine_partition (env);
 }
 
 void Internal::flip_backbone_literals (Sweeper &sweeper) {
@@ -1531,67 +1611,11 @@ const char *Internal::sweep_variable (Sweeper &sweeper, int idx) {
 
   LOG ("sweeping %d", idx);
   assert (!val (start));
-  LOG ("starting sweeping[0]");
-  add_literal_to_environment (sweeper, 0, start);
-  LOG ("finished sweeping[0]");
-  LOG ("starting sweeping[1]");
-
-  bool limit_reached = false;
-  size_t expand = 0, next = 1;
+  unsigned depth;
+  bool limit_reached =
+      sweep_environment (sweeper, start, depth, sweeper.current_ticks);
   bool success = false;
-  unsigned depth = 1;
 
-  uint64_t &ticks = sweeper.current_ticks;
-  while (!limit_reached) {
-    if (sweeper.encoded >= sweeper.limit.clauses) {
-      LOG ("environment clause limit reached");
-      limit_reached = true;
-      break;
-    }
-    if (expand == next) {
-      LOG ("finished sweeping[%u]", depth);
-      if (depth >= sweeper.limit.depth) {
-        LOG ("environment depth limit reached");
-        break;
-      }
-      next = sweeper.vars.size ();
-      if (expand == next) {
-        LOG ("completely copied all clauses");
-        break;
-      }
-      depth++;
-      LOG ("starting sweeping[%u]", depth);
-    }
-    const unsigned choices = next - expand;
-    if (opts.sweeprand && choices > 1) {
-      const unsigned swaps = sweeper.random.pick_int (0, choices - 1);
-      if (swaps) {
-        assert (expand + swaps < sweeper.vars.size ());
-        swap (sweeper.vars[expand], sweeper.vars[expand + swaps]);
-      }
-    }
-    const int idx = sweeper.vars[expand];
-    LOG ("traversing and adding clauses of %d", idx);
-    for (unsigned sign = 0; sign < 2; sign++) {
-      const int lit = sign ? -idx : idx;
-      ticks += 1 + cache_lines (occs (lit).size (), sizeof (Clause *));
-      Occs &ns = occs (lit);
-      for (auto c : ns) {
-        ticks++;
-        if (!can_sweep_clause (c))
-          continue;
-        sweep_clause (sweeper, depth, c);
-        if (sweeper.vars.size () >= sweeper.limit.vars) {
-          LOG ("environment variable limit reached");
-          limit_reached = true;
-          break;
-        }
-      }
-      if (limit_reached)
-        break;
-    }
-    expand++;
-  }
   stats.sweep_depth += depth;
   stats.sweep_clauses += sweeper.encoded;
   stats.sweep_environment += sweeper.vars.size ();
@@ -1875,6 +1899,293 @@ void Internal::unschedule_sweeping (Sweeper &sweeper, unsigned swept,
          swept, incomplete, percent (incomplete, scheduled));
 }
 
+/*------------------------------------------------------------------------*/
+
+// With 'opts.sweepthreads' positive, the next scheduled variables are
+// swept speculatively in parallel, each thread with its own 'kitten'
+// instance.  The threads only read the occurrence lists, the root-level
+// assignment and the representatives, do not trace proofs and do not
+// change the formula.  Only variables for which they find a backbone
+// literal or an equivalence (or hit the limit) are swept sequentially
+// afterwards, which again finds and adds them with proofs through the
+// usual refinement functions.  All other variables are skipped and only
+// their ticks are charged.  Checks remain valid until they are used even
+// if variables are found equivalent in between.  Variables rescheduled
+// after a chunk was checked are swept sequentially.
+
+struct SweepCheck {
+  int idx;
+  bool promising; // worth to be swept sequentially
+  uint64_t ticks;
+};
+
+// Builds and refines the environment with the same functions as
+// 'sweep_variable' but with its own 'kitten'.  Random decisions are seeded
+// by the candidate and thus do not depend on which thread checks it.
+
+struct SweepWorker : SweepEnvironment {
+
+  Internal *internal;
+  vector<bool> expanded;
+  int expanding;
+  unsigned clauses;
+  uint64_t ticks, start, remaining;
+
+  SweepWorker (Internal *i, const Sweeper *sweeper)
+      : SweepEnvironment (i->opts.seed), internal (i),
+        expanded (i->max_var + 1, false), expanding (0), clauses (0),
+        ticks (0), start (0), remaining (0) {
+    depths.resize (i->max_var + 1, 0);
+    reprs = sweeper->reprs;
+    limit = sweeper->limit;
+  }
+
+  int solve () {
+    kitten_randomize_phases (citten);
+    return kitten_solve (citten);
+  }
+
+  uint64_t kitten_ticks () { return kitten_current_ticks (citten) - start; }
+  bool limit_hit () { return kitten_ticks () >= remaining; }
+
+  // Clauses with another already expanded variable were added before,
+  // where the previous variable is expanded when the next one is visited.
+
+  void add_clause (unsigned depth, Clause *c, int pivot) override {
+    if (pivot != expanding) {
+      if (expanding)
+        expanded[expanding] = true;
+      expanding = pivot;
+    }
+    for (const auto &lit : *c) {
+      const int idx = abs (lit);
+      const signed char tmp = internal->val (lit);
+      if (tmp > 0 || (idx != pivot && expanded[idx])) {
+        clause.clear ();
+        return;
+      }
+      if (!tmp)
+        clause.push_back (lit);
+    }
+    internal->sweep_add_clause (*this, depth, clauses++);
+  }
+
+  void flip_backbone () {
+    for (int round = 0; round < internal->opts.sweepfliprounds;
+         round++) {
+      if (kitten_status (citten) != 10)
+        return;
+      unsigned flipped = 0;
+      auto q = backbone.begin ();
+      for (const auto &lit : backbone)
+        if (kitten_flip_signed_literal (citten, lit))
+          flipped++;
+        else
+          *q++ = lit;
+      backbone.resize (q - backbone.begin ());
+      if (!flipped || limit_hit ())
+        return;
+    }
+  }
+
+  void flip_partition () {
+    for (int round = 0; round < internal->opts.sweepfliprounds;
+         round++) {
+      if (kitten_status (citten) != 10)
+        return;
+      unsigned flipped = 0;
+      const auto end = partition.end ();
+      auto dst = partition.begin (), src = dst;
+      while (src != end) {
+        auto end_src = src;
+        while (*end_src)
+          end_src++;
+        unsigned size = end_src - src;
+        auto q = dst;
+        for (auto p = src; p != end_src; p++) {
+          const int lit = *p;
+          if (kitten_flip_signed_literal (citten, lit)) {
+            flipped++;
+            if (--size < 2)
+              break;
+          } else
+            *q++ = lit;
+        }
+        if (size > 1) {
+          *q++ = 0;
+          dst = q;
+        }
+        src = end_src + 1;
+      }
+      partition.resize (dst - partition.begin ());
+      if (!flipped || limit_hit ())
+        return;
+    }
+  }
+
+  // Same as 'sweep_backbone_candidate'.  Returns true if a unit was found
+  // or the solver gave up.
+
+  bool backbone_candidate (int lit) {
+    if (kitten_fixed_signed (citten, lit))
+      return internal->val (lit) <= 0;
+    if (kitten_status (citten) == 10 &&
+        kitten_flip_signed_literal (citten, lit))
+      return false;
+    kitten_assume_signed (citten, -lit);
+    const int res = solve ();
+    if (res == 10)
+      internal->sweep_refine (*this);
+    return res != 10;
+  }
+
+  // Remove the last or second to last literal of the last class.
+
+  void drop_candidate (bool last) {
+    const auto end = partition.end ();
+    if (end - partition.begin () == 3 || end[-4] == 0)
+      partition.resize (partition.size () - 3);
+    else {
+      if (!last)
+        end[-3] = end[-2];
+      end[-2] = 0;
+      partition.resize (partition.size () - 1);
+    }
+  }
+
+  // Same as 'sweep_equivalence_candidates'.  Returns true if an
+  // equivalence was found or the solver gave up.
+
+  bool equivalence_candidates (int lit, int other) {
+    if (kitten_status (citten) == 10) {
+      if (kitten_flip_signed_literal (citten, lit))
+        return drop_candidate (false), false;
+      if (kitten_flip_signed_literal (citten, other))
+        return drop_candidate (true), false;
+    }
+    if (abs (lit) > abs (other) && internal->frozen (lit))
+      return drop_candidate (false), false;
+    if (abs (other) > abs (lit) && internal->frozen (other))
+      return drop_candidate (true), false;
+    for (int sign = 1; sign >= -1; sign -= 2) {
+      kitten_assume_signed (citten, -sign * lit);
+      kitten_assume_signed (citten, sign * other);
+      const int res = solve ();
+      if (res == 10)
+        internal->sweep_refine (*this);
+      if (res != 20)
+        return !res;
+    }
+    return true;
+  }
+
+  bool promising (int idx) {
+    if (!internal->active (idx) || repr (idx) != idx)
+      return true;
+    unsigned depth;
+    internal->sweep_environment (*this, idx, depth, ticks);
+    if (vars.size () == 1)
+      return false;
+    if (solve () != 10)
+      return true;
+    internal->init_backbone_and_partition (*this);
+    while (!backbone.empty ()) {
+      if (limit_hit ())
+        return true;
+      flip_backbone ();
+      if (backbone.empty ())
+        break;
+      const int lit = backbone.back ();
+      backbone.pop_back ();
+      if (internal->active (lit) && backbone_candidate (lit))
+        return true;
+    }
+    while (!partition.empty ()) {
+      if (limit_hit ())
+        return true;
+      flip_partition ();
+      if (partition.size () > 2) {
+        const auto end = partition.end ();
+        if (equivalence_candidates (end[-3], end[-2]))
+          return true;
+      } else
+        partition.clear ();
+    }
+    return false;
+  }
+
+  // Every check uses a new 'kitten', since random phases also depend on
+  // the size of the environments solved before by the same instance.
+
+  void check (SweepCheck &check) {
+    citten = kitten_init ();
+    random = internal->opts.seed;
+    random += internal->stats.sweep;
+    random += check.idx;
+    kitten_seed (citten, random.next ());
+    kitten_set_ticks_limit (citten, remaining);
+    start = kitten_current_ticks (citten);
+    ticks = 0;
+    check.promising = promising (check.idx);
+    check.ticks = ticks + kitten_ticks ();
+    for (const auto &idx : vars)
+      depths[idx] = 0, expanded[idx] = false;
+    vars.clear ();
+    backbone.clear ();
+    partition.clear ();
+    expanding = 0;
+    encoded = clauses = 0;
+    kitten_release (citten);
+    citten = 0;
+  }
+};
+
+// Check the next scheduled variables in parallel.  The size of the chunk
+// is estimated from the average ticks of previous checks ('checked' and
+// 'ticks') such that it does not exceed the remaining ticks by much.
+
+static void sweep_check_chunk (Internal *internal, const Sweeper &sweeper,
+                               vector<SweepCheck> &checks,
+                               vector<SweepWorker> &workers,
+                               uint64_t &checked, uint64_t &ticks) {
+  const uint64_t current =
+      sweeper.current_ticks + kitten_current_ticks (internal->citten);
+  const uint64_t limit =
+      current < sweeper.limit.ticks ? sweeper.limit.ticks - current : 0;
+  uint64_t size = 8;
+  if (checked) {
+    const uint64_t average = ticks / checked + 1;
+    size = max (size, min ((uint64_t) 1 << 10, limit / average));
+  }
+  checks.clear ();
+  for (int idx = sweeper.last; idx && checks.size () < size;
+       idx = sweeper.prev[idx])
+    checks.push_back ({idx, false, 0});
+  size = checks.size ();
+  const size_t threads = min ((size_t) internal->opts.sweepthreads, size);
+  while (workers.size () < threads)
+    workers.push_back (SweepWorker (internal, &sweeper));
+  std::atomic<size_t> next (0);
+  internal->pool.run (threads, [&] (size_t worker) {
+    SweepWorker &w = workers[worker];
+    w.remaining = limit;
+    size_t i;
+    while ((i = next++) < size)
+      w.check (checks[i]);
+  });
+  checked += size;
+  for (const auto &check : checks)
+    ticks += check.ticks;
+}
+
+static const char *sweep_skip_variable (Internal *internal,
+                                        Sweeper &sweeper,
+                                        const SweepCheck &check) {
+  internal->stats.sweep_skipped++;
+  sweeper.current_ticks += check.ticks;
+  return "skipped after parallel check";
+}
+
 bool Internal::sweep () {
   if (!opts.sweep)
     return false;
@@ -1895,7 +2206,7 @@ bool Internal::sweep () {
   stats.sweep++;
   uint64_t equivalences = stats.sweep_equivalences;
   uint64_t units = stats.sweep_units;
-  Sweeper sweeper = Sweeper (this);
+  Sweeper sweeper (this);
   if (opts.sweepcomplete)
     sweeper.limit.ticks = INT64_MAX;
   else
@@ -1903,6 +2214,13 @@ bool Internal::sweep () {
   sweep_set_kitten_ticks_limit (sweeper);
   const unsigned scheduled = schedule_sweeping (sweeper);
   uint64_t swept = 0, limit = 10;
+  const bool parallel = opts.sweepthreads > 0;
+  vector<SweepCheck> checks;
+  vector<SweepWorker> workers;
+  vector<unsigned> checked; // position in 'checks' plus one
+  if (parallel)
+    checked.resize (max_var + 1, 0);
+  uint64_t checks_total = 0, checks_ticks = 0;
   for (;;) {
     if (unsat)
       break;
@@ -1910,14 +2228,37 @@ bool Internal::sweep () {
       break;
     if (kitten_ticks_limit_hit (sweeper, "sweeping loop"))
       break;
+    if (parallel && sweeper.last && !checked[sweeper.last]) {
+      bool pending = false;
+      for (const auto &check : checks)
+        if (checked[check.idx] && scheduled_variable (sweeper, check.idx)) {
+          pending = true;
+          break;
+        }
+      if (!pending) {
+        for (const auto &check : checks)
+          checked[check.idx] = 0;
+        sweep_check_chunk (this, sweeper, checks, workers, checks_total,
+                           checks_ticks);
+        for (size_t i = 0; i < checks.size (); i++)
+          checked[checks[i].idx] = i + 1;
+      }
+    }
     int idx = next_scheduled (sweeper);
     if (idx == 0)
       break;
     flags (idx).sweep = false;
+    const SweepCheck *check = 0;
+    if (parallel && checked[idx]) {
+      check = &checks[checked[idx] - 1];
+      checked[idx] = 0;
+    }
 #ifndef QUIET
     const char *res =
 #endif
-        sweep_variable (sweeper, idx);
+        (check && !check->promising)
+            ? sweep_skip_variable (this, sweeper, *check)
+            : sweep_variable (sweeper, idx);
     VERBOSE (3, "swept[%" PRIu64 "] external variable %d %s", swept,
              externalize (idx), res);
     if (++swept == limit) {
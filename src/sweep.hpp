@@ -1,6 +1,8 @@
 #ifndef _sweep_hpp_INCLUDED
 #define _sweep_hpp_INCLUDED
 
+struct kitten;
+
 namespace CaDiCaL {
 
 struct Internal;
@@ -26,34 +28,63 @@ struct sweep_binary {
   int64_t id;
 };
 
-struct Sweeper {
-  Sweeper (Internal *internal);
-  ~Sweeper ();
-  Internal *internal;
+// The environment of a swept variable encoded in its own 'kitten' instance
+// together with the backbone and equivalence candidates.  Sequential
+// sweeping uses the one of 'Sweeper' while the parallel workers in
+// 'sweep.cpp' each have their own.  Both only differ in how clauses are
+// added, i.e., the sequential one also removes satisfied clauses and keeps
+// the added clauses for proofs.
+
+struct SweepEnvironment {
+  SweepEnvironment (uint64_t seed)
+      : citten (0), random (seed), reprs (0), encoded (0) {}
+  virtual ~SweepEnvironment () {}
+  kitten *citten;
   Random random;
   vector<unsigned> depths;
   int *reprs;
+  unsigned encoded;
+  vector<int> vars;
+  vector<int> clause;
+  vector<int> backbone;
+  vector<int> partition;
+  struct {
+    uint64_t ticks;
+    unsigned clauses, depth, vars;
+  } limit;
+
+  // Representative without path compression.
+  //
+  int repr (int lit) const {
+    int res;
+    while ((res = reprs[lit]) != lit)
+      lit = res;
+    return res;
+  }
+
+  // Called for all clauses of the expanded variable 'pivot' which can be
+  // swept, but might already have been added for another variable.
+  //
+  virtual void add_clause (unsigned depth, Clause *, int pivot) = 0;
+};
+
+struct Sweeper : SweepEnvironment {
+  Sweeper (Internal *internal);
+  ~Sweeper ();
+  Internal *internal;
   vector<int> next, prev;
   int first, last, blit;
-  unsigned encoded;
   unsigned save;
-  vector<int> vars;
   vector<Clause *> clauses;
   vector<sweep_blocked_clause> blocked_clauses;
   bool flush_blocked_clauses;
   vector<int> blockable;
-  vector<int> clause;
   vector<int> propagate;
-  vector<int> backbone;
-  vector<int> partition;
   vector<bool> prev_units;
   vector<sweep_binary> binaries;
   vector<sweep_proof_clause> core[2];
   uint64_t current_ticks;
-  struct {
-    uint64_t ticks;
-    unsigned clauses, depth, vars;
-  } limit;
+  void add_clause (unsigned depth, Clause *, int pivot) override;
 };
 
 } // namespace CaDiCaL
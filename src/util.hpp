@@ -101,6 +101,17 @@ template <class T> void shrink_vector (std::vector<T> &v) {
   assert (v.capacity () == v.size ()); // not guaranteed though
 }
 
+// Shrinking as above allocates and copies the vector, which for the many
+// small per-literal watch and occurrence lists flushed during garbage
+// collection leads to a lot of heap churn and fragmentation, in particular
+// as these lists usually grow again right afterwards.  Thus for those we
+// only shrink if more than half of the capacity is unused.
+
+template <class T> void shrink_sparse_vector (std::vector<T> &v) {
+  if (v.capacity () > 2 * v.size ())
+    shrink_vector (v);
+}
+
 template <class T>
 static void enlarge_init (vector<T> &v, size_t N, const T &i) {
   if (v.size () < N)
@@ -2,6 +2,7 @@
 #include "internal.hpp"
 #include "util.hpp"
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <utility>
 
@@ -245,13 +246,11 @@ bool Internal::vivify_propagate (int64_t &ticks) {
           literal_iterator k = middle;
           signed char v = -1;
           int r = 0;
-          while (k != end && (v = val (r = *k)) < 0)
-            k++;
+          k = search_replacement (k, end, r, v);
           if (v < 0) {
             k = lits + 2;
             assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
+            k = search_replacement (k, middle, r, v);
           }
           w.clause->pos = k - lits;
           assert (lits + 2 <= k), assert (k <= w.clause->end ());
@@ -1496,6 +1495,262 @@ struct vivify_inversesize_smaller {
   }
 };
 
+/*------------------------------------------------------------------------*/
+
+// With 'opts.vivifythreads' positive, scheduled candidates are checked in
+// parallel for chunks of consecutive candidates before they are vivified.
+// Each worker assumes the negation of the sorted literals of a candidate
+// and propagates on a private trail, reading the shared watches and root
+// level assignment only, while the main thread waits at the root level.
+// Since watches can not be moved, clauses which are not unit yet are
+// watched again in private watch lists (with their own two watched
+// literals, which in contrast to the shared watches are moved).  Only
+// candidates for which a conflict, an implied literal or a successful
+// instantiation was found are then vivified sequentially in schedule
+// order.  All others are skipped and only their ticks are charged.  Chunks
+// do not depend on the number of threads, and neither does the result.
+
+struct VivifyCheck {
+  Clause *candidate;
+  bool promising; // worth to be vivified sequentially
+  int64_t ticks;
+};
+
+struct VivifyWorker {
+
+  // A clause watched privately by the two (non-false) literals 'lits',
+  // with the next clause watched by the same literal in 'next'.
+  //
+  struct Watched {
+    Clause *clause;
+    int lits[2];
+    int next[2];
+  };
+
+  Internal *internal;
+  std::vector<signed char> vals; // private assignment
+  std::vector<int> heads;        // private watches (indexed by literal)
+  std::vector<Watched> watches;
+  std::vector<int> watched; // literals with (once) non-empty 'heads'
+  std::vector<int> trail;
+  std::vector<int> sorted;
+  size_t propagated;
+  int64_t ticks;
+
+  VivifyWorker (Internal *i)
+      : internal (i), vals (2u * (i->max_var + 1), 0),
+        heads (2u * (i->max_var + 1), -1), propagated (0), ticks (0) {}
+
+  signed char val (int lit) const {
+    const signed char tmp = internal->val (lit);
+    return tmp ? tmp : vals[internal->vlit (lit)];
+  }
+
+  void assign (int lit) {
+    assert (!val (lit));
+    vals[internal->vlit (lit)] = 1;
+    vals[internal->vlit (-lit)] = -1;
+    trail.push_back (lit);
+  }
+
+  void watch (int lit, int idx, int pos) {
+    int &head = heads[internal->vlit (lit)];
+    if (head < 0)
+      watched.push_back (lit);
+    Watched &w = watches[idx];
+    w.lits[pos] = lit;
+    w.next[pos] = head;
+    head = idx;
+  }
+
+  void backtrack (size_t new_trail_size) {
+    while (trail.size () > new_trail_size) {
+      const int lit = trail.back ();
+      trail.pop_back ();
+      vals[internal->vlit (lit)] = vals[internal->vlit (-lit)] = 0;
+    }
+    if (propagated > new_trail_size)
+      propagated = new_trail_size;
+  }
+
+  void reset () {
+    backtrack (0);
+    for (const auto &lit : watched)
+      heads[internal->vlit (lit)] = -1;
+    watched.clear ();
+    watches.clear ();
+  }
+
+  // Visits a clause found in the shared watches.  Returns false on
+  // conflict.  Otherwise 'c' is either satisfied, its single unassigned
+  // literal is assigned, or two of its unassigned literals are watched
+  // privately.
+
+  bool visit (Clause *c) {
+    ticks++;
+    int first = 0, second = 0;
+    for (const auto &lit : *c) {
+      const signed char tmp = val (lit);
+      if (tmp > 0)
+        return true;
+      if (tmp < 0)
+        continue;
+      if (first) {
+        second = lit;
+        break;
+      }
+      first = lit;
+    }
+    if (!first)
+      return false;
+    if (!second) {
+      assign (first);
+      return true;
+    }
+    const int idx = watches.size ();
+    watches.push_back ({c, {0, 0}, {-1, -1}});
+    watch (first, idx, 0);
+    watch (second, idx, 1);
+    return true;
+  }
+
+  // As in 'propagate' of the solver, the privately watched clauses of the
+  // falsified literal 'lit' either get a replacement watch, are satisfied
+  // by the other watch, are unit or are in conflict.
+
+  bool propagate_private (int lit) {
+    int *link = &heads[internal->vlit (lit)];
+    while (*link >= 0) {
+      const int idx = *link;
+      Watched &w = watches[idx];
+      const int pos = (w.lits[1] == lit);
+      assert (w.lits[pos] == lit);
+      const int other = w.lits[!pos];
+      const signed char v = val (other);
+      if (v > 0) {
+        link = &w.next[pos];
+        continue;
+      }
+      ticks++;
+      int replacement = 0;
+      signed char tmp = 0;
+      for (const auto &r : *w.clause) {
+        if (r == w.lits[0] || r == w.lits[1])
+          continue;
+        tmp = val (r);
+        if (tmp < 0)
+          continue;
+        replacement = r;
+        break;
+      }
+      if (tmp > 0) {
+        link = &w.next[pos];
+        continue;
+      }
+      if (replacement) {
+        *link = w.next[pos];
+        watch (replacement, idx, pos);
+        continue;
+      }
+      if (v < 0)
+        return false;
+      assign (other);
+      link = &w.next[pos];
+    }
+    return true;
+  }
+
+  bool propagate (Clause *ignore) {
+    while (propagated < trail.size ()) {
+      const int lit = -trail[propagated++];
+      const Watches &ws = internal->watches (lit);
+      ticks += 1 + internal->cache_lines (ws.size (), sizeof (Watch));
+      for (const auto &w : ws) {
+        const signed char b = val (w.blit);
+        if (b > 0)
+          continue;
+        if (w.binary ()) {
+          if (b < 0)
+            return false;
+          assign (w.blit);
+          continue;
+        }
+        if (w.clause == ignore || w.clause->garbage)
+          continue;
+        if (!visit (w.clause))
+          return false;
+      }
+      if (!propagate_private (lit))
+        return false;
+    }
+    return true;
+  }
+
+  // Same decisions as in 'vivify_clause' (and 'vivify_instantiate').
+
+  bool promising (Clause *c) {
+    sorted.clear ();
+    for (const auto &lit : *c) {
+      const signed char tmp = internal->val (lit);
+      if (tmp > 0)
+        return true;
+      if (!tmp)
+        sorted.push_back (lit);
+    }
+    if (sorted.size () <= 2)
+      return true;
+    sort (sorted.begin (), sorted.end (),
+          vivify_more_noccs_kissat (internal));
+    size_t decision = 0;
+    for (const auto &lit : sorted) {
+      if (val (lit))
+        return true;
+      decision = trail.size ();
+      assign (-lit);
+      if (!propagate (c))
+        return true;
+    }
+    if (!internal->opts.vivifyinst)
+      return false;
+    backtrack (decision);
+    assign (sorted.back ());
+    return !propagate (c);
+  }
+};
+
+static void vivify_check_candidate (VivifyWorker &worker,
+                                    VivifyCheck &check) {
+  worker.ticks = 0;
+  check.promising = worker.promising (check.candidate);
+  check.ticks = worker.ticks;
+  worker.reset ();
+}
+
+// Check the last 'size' candidates of the schedule in parallel, the first
+// to be vivified first.
+
+static void vivify_check_chunk (Internal *internal,
+                                const std::vector<Clause *> &schedule,
+                                size_t size,
+                                std::vector<VivifyCheck> &checks,
+                                std::vector<VivifyWorker> &workers) {
+  assert (!internal->level);
+  size = std::min (schedule.size (), size);
+  checks.resize (size);
+  for (size_t i = 0; i < size; i++)
+    checks[i].candidate = schedule[schedule.size () - 1 - i];
+  const size_t threads =
+      std::min ((size_t) internal->opts.vivifythreads, size);
+  while (workers.size () < threads)
+    workers.push_back (VivifyWorker (internal));
+  std::atomic<size_t> next (0);
+  internal->pool.run (threads, [&] (size_t worker) {
+    size_t i;
+    while ((i = next++) < size)
+      vivify_check_candidate (workers[worker], checks[i]);
+  });
+}
+
 /*------------------------------------------------------------------------*/
 // There are two modes of vivification, one using all clauses and one
 // focusing on irredundant clauses only.  The latter variant working on
@@ -1596,10 +1851,36 @@ void Internal::vivify_round (Vivifier &vivifier, int64_t ticks_limit) {
 
   vivifier.ticks = ticks;
   int retry = 0;
+  const bool parallel = opts.vivifythreads > 0;
+  std::vector<VivifyCheck> checks;
+  std::vector<VivifyWorker> workers;
+  size_t chunk = 8, next = 0;
   while (!unsat && !terminated_asynchronously () && !schedule.empty () &&
          vivifier.ticks < limit) {
+    if (parallel && !retry && next == checks.size ()) {
+      if (level)
+        backtrack_without_updating_phases ();
+      // Most rounds are stopped early by the ticks limit, thus chunks
+      // start small and are doubled to avoid checking in vain.
+      //
+      chunk = std::min (2 * chunk, (size_t) 1 << 10);
+      vivify_check_chunk (this, schedule, chunk, checks, workers);
+      next = 0;
+    }
     Clause *c = schedule.back (); // Next candidate.
     schedule.pop_back ();
+    if (parallel && !retry) {
+      const VivifyCheck &check = checks[next++];
+      assert (check.candidate == c);
+      if (!check.promising) {
+        LOG (c, "skipping vivification of");
+        c->vivify = false;
+        c->vivified = true;
+        vivifier.ticks += check.ticks;
+        stats.vivifyskipped++;
+        continue;
+      }
+    }
     if (vivify_clause (vivifier, c) && !c->garbage && c->size > 2 &&
         retry < opts.vivifyretry) {
       ++retry;
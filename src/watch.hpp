@@ -16,6 +16,16 @@ namespace CaDiCaL {
 // however limit the number of clauses to '2^32 - 1'.  One would also need
 // to use at least one more bit (either taken away from the variable space
 // or the clauses) to denote whether the watch is binary.
+//
+// Note that such a compact 8 byte watch would further require all clauses
+// to reside in the arena, which is not the case here.  Learned clauses are
+// allocated outside of the arena and only moved into it during the next
+// arena based garbage collection (see 'copy_non_garbage_clauses' and the
+// comments in 'arena.hpp'), the arena is optional ('opts.arena') and it is
+// not used at all for the first collections ('arenaing').  Binary watches
+// still need the clause for conflict analysis, LRAT chains and delayed
+// deletion of garbage binary clauses (see 'propagate').  Thus we keep the
+// 16 byte watches and rely on the arena ordering for locality instead.
 
 // in fashion of Intel Sat 10.4230/LIPIcs.SAT.2022.8 we try to
 // guarantee the following invariant:
@@ -0,0 +1,129 @@
+#include "../../src/cadical.hpp"
+
+#include <iostream>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+extern "C" {
+#include <assert.h>
+}
+
+// Export all clauses learned by one solver and import them into another.
+
+class Exchange : public CaDiCaL::Learner, public CaDiCaL::Importer {
+  size_t next;
+
+public:
+  std::vector<int> clauses;
+  unsigned learned;
+  Exchange () : next (0), learned (0) {}
+  bool learning (int size) {
+    (void) size;
+    return true;
+  }
+  void learn (int lit) {
+    clauses.push_back (lit);
+    if (!lit)
+      learned++;
+  }
+  bool importing () { return next < clauses.size (); }
+  int import () { return clauses[next++]; }
+};
+
+// Loads the next clause on every call to 'importing' (as the clause sharing
+// of the portfolio in 'cadical.cpp') and makes only one more clause
+// available whenever there is nothing to import (as if another solver
+// learned it in the mean time).  Each announced clause has to be read
+// completely before 'importing' is called again.
+
+class Loader : public CaDiCaL::Importer {
+  const std::vector<int> &clauses;
+  std::vector<int> loaded;
+  size_t position, available, next;
+
+public:
+  unsigned announced, imported;
+  Loader (const std::vector<int> &c)
+      : clauses (c), position (0), available (0), next (0), announced (0),
+        imported (0) {}
+  bool importing () {
+    assert (loaded.empty ());
+    if (!available) {
+      available = 1;
+      return false;
+    }
+    if (position == clauses.size ())
+      return false;
+    available--;
+    int lit;
+    do
+      loaded.push_back (lit = clauses[position++]);
+    while (lit);
+    next = 0;
+    announced++;
+    return true;
+  }
+  int import () {
+    assert (next < loaded.size ());
+    const int lit = loaded[next++];
+    if (!lit)
+      loaded.clear (), imported++;
+    return lit;
+  }
+  bool complete () const { return loaded.empty (); }
+};
+
+// Pigeon hole formula with 'n + 1' pigeons and 'n' holes.
+
+static void formula (CaDiCaL::Solver &solver, int n) {
+  auto p = [n] (int i, int j) { return i * n + j + 1; };
+  for (int i = 0; i <= n; i++) {
+    for (int j = 0; j < n; j++)
+      solver.add (p (i, j));
+    solver.add (0);
+  }
+  for (int j = 0; j < n; j++)
+    for (int i = 0; i <= n; i++)
+      for (int k = i + 1; k <= n; k++)
+        solver.add (-p (i, j)), solver.add (-p (k, j)), solver.add (0);
+}
+
+int main () {
+  CaDiCaL::Solver ping, pong;
+  ping.set ("factor", 0), pong.set ("factor", 0);
+  Exchange exchange;
+  ping.connect_learner (&exchange);
+  formula (ping, 6);
+  int a = ping.solve ();
+  ping.disconnect_learner ();
+  std::cout << "ping returns " << a << " after learning "
+            << exchange.learned << " clauses" << std::endl;
+  pong.connect_importer (&exchange);
+  formula (pong, 6);
+  int b = pong.solve ();
+  pong.disconnect_importer ();
+  int64_t imported = pong.get_statistic_value ("imported");
+  std::cout << "pong returns " << b << " after importing " << imported
+            << " clauses" << std::endl;
+  assert (a == 20), assert (b == 20);
+  assert (exchange.learned > 0);
+  assert (imported > 0);
+  CaDiCaL::Solver pang;
+  pang.set ("factor", 0);
+  Loader loader (exchange.clauses);
+  pang.connect_importer (&loader);
+  formula (pang, 6);
+  int c = pang.solve ();
+  pang.disconnect_importer ();
+  std::cout << "pang returns " << c << " after reading " << loader.imported
+            << " of " << loader.announced << " announced clauses"
+            << std::endl;
+  assert (c == 20);
+  assert (loader.announced > 0);
+  assert (loader.complete ());
+  assert (loader.imported == loader.announced);
+  return 0;
+}
@@ -0,0 +1,64 @@
+#include "../../src/cadical.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+extern "C" {
+#include <assert.h>
+}
+
+// Poll the progress snapshot from another thread while solving.
+
+static void formula (CaDiCaL::Solver &solver, int n) {
+  auto p = [n] (int i, int j) { return i * n + j + 1; };
+  for (int i = 0; i <= n; i++) {
+    for (int j = 0; j < n; j++)
+      solver.add (p (i, j));
+    solver.add (0);
+  }
+  for (int j = 0; j < n; j++)
+    for (int i = 0; i <= n; i++)
+      for (int k = i + 1; k <= n; k++)
+        solver.add (-p (i, j)), solver.add (-p (k, j)), solver.add (0);
+}
+
+int main () {
+  CaDiCaL::Solver solver;
+  solver.set ("factor", 0);
+  solver.set ("progressint", 100);
+  assert (!solver.progress ().conflicts);
+  formula (solver, 10);
+  solver.limit ("conflicts", 30000);
+  std::atomic<bool> done (false);
+  unsigned polls = 0;
+  int64_t last = 0;
+  std::thread monitor ([&] () {
+    while (!done.load ()) {
+      const CaDiCaL::Solver::Progress progress = solver.progress ();
+      assert (progress.conflicts >= last);
+      assert (progress.decisions >= 0);
+      assert (progress.irredundant >= 0);
+      last = progress.conflicts;
+      polls++;
+      std::this_thread::yield ();
+    }
+  });
+  int res = solver.solve ();
+  done = true;
+  monitor.join ();
+  const CaDiCaL::Solver::Progress progress = solver.progress ();
+  std::cout << "solve returns " << res << " after " << progress.conflicts
+            << " conflicts polled " << polls << " times" << std::endl;
+  assert (!res);
+  assert (progress.conflicts == solver.get_statistic_value ("conflicts"));
+  assert (progress.decisions == solver.get_statistic_value ("decisions"));
+  assert (progress.irredundant == solver.irredundant ());
+  assert (progress.memory > 0);
+  assert (last <= progress.conflicts);
+  return 0;
+}
@@ -86,7 +86,8 @@ run () {
     src=$tests/$1.cpp
     language=""
     COMPILE="$CXX $CXXFLAGS"
-    [ x"$1" = xparcompwrite ] && COMPILE="$COMPILE -pthread"
+    [ x"$1" = xparcompwrite -o x"$1" = xprogress ] && \
+      COMPILE="$COMPILE -pthread"
   else
     die "can not find '$tests.c' nor '$tests.cpp'"
   fi
@@ -118,6 +119,7 @@ run example_constraint
 run example_tracer
 run terminate
 run learn
+run import
 run cfreeze
 run traverse
 run cipasir
@@ -125,6 +127,7 @@ run incproof
 run propagate_assumptions
 run example_propagators
 run parcompwrite
+run progress
 
 if [ "`grep DNTRACING $makefile`" = "" ]
 then
@@ -118,6 +118,71 @@ do
   run 20 $option ../test/cnf/add16.cnf
 done
 
+for option in --threads=1 --threads=2 --threads=5
+do
+  run 10 $option ../test/cnf/prime2209.cnf
+  run 20 $option ../test/cnf/add16.cnf
+done
+
+run 1 --threads=0 ../test/cnf/add16.cnf
+
+for option in "--deterministic --threads=2" "--deterministic=1000 --threads=3"
+do
+  run 10 $option ../test/cnf/prime2209.cnf
+  run 20 $option ../test/cnf/add16.cnf
+done
+
+run 1 --deterministic=0 ../test/cnf/add16.cnf
+run 1 --deterministic --cubes=2 ../test/cnf/add16.cnf
+run 1 --deterministic ../test/cnf/add16.cnf
+run 1 --deterministic --threads=1 ../test/cnf/add16.cnf
+
+# Deterministic portfolio solving has to produce the same statistics if
+# run twice.  Only the name and the first number of the statistics lines
+# are compared, since the rest contains (varying) times.
+
+statistics () {
+  sed -n -e '/\[ statistics \]/,/\[ resources \]/p' $1 | \
+  awk '{print $2, $3}'
+}
+
+same () {
+  options="$*"
+  name=`echo "$options"|sed -e 's,\.\./test/.*/,,g' -e 's,\.cnf\>,,g' -e 's,[ \./=],-,g' -e 's,--*,-,g'`
+  msg "running usage test ${HILITE}'test-usage-same$name'${NORMAL}"
+  buildprefix="$CADICALBUILD/test-usage-same$name"
+  cmd="$solver --stats $options"
+  cecho -n "$cmd (twice)"
+  $cmd 1>$buildprefix-1.log 2>$buildprefix-1.err
+  $cmd 1>$buildprefix-2.log 2>$buildprefix-2.err
+  statistics $buildprefix-1.log > $buildprefix-1.stats
+  statistics $buildprefix-2.log > $buildprefix-2.stats
+  if [ -s $buildprefix-1.stats ] && \
+     cmp -s $buildprefix-1.stats $buildprefix-2.stats
+  then
+    cecho " # ${GOOD}ok${NORMAL} (same statistics)"
+    ok=`expr $ok + 1`
+  else
+    cecho " # ${BAD}FAILED${NORMAL} (statistics differ)"
+    failed=`expr $failed + 1`
+  fi
+}
+
+same --threads=4 --deterministic=10000 ../test/cnf/prime4294967297.cnf
+same --threads=3 --deterministic ../test/cnf/sqrt10201.cnf
+
+for option in "--cubes=2" "--cubes=4 --threads=3"
+do
+  run 10 $option ../test/cnf/prime2209.cnf
+  run 20 $option ../test/cnf/add16.cnf
+done
+
+run 1 --cubes=0 ../test/cnf/add16.cnf
+
+run 10 --conflict-profile=$CADICALBUILD/test-usage-profile.json ../test/cnf/prime2209.cnf
+run 20 --cprofiletop=1 --conflict-profile=$CADICALBUILD/test-usage-profile.json ../test/cnf/add16.cnf
+run 1 --conflict-profile= ../test/cnf/add16.cnf
+
 # run 0 -t
 # run 0 -O
 # run 0 -c 0